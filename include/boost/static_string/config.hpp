@@ -51,6 +51,28 @@
 #define BOOST_STATIC_STRING_IS_CONST_EVAL __builtin_is_constant_evaluated()
 #endif
 
+// Can we use std::format?
+// Define BOOST_STATIC_STRING_NO_FORMAT to disable it.
+#if !defined(BOOST_STATIC_STRING_NO_FORMAT) && \
+    defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+#define BOOST_STATIC_STRING_HAS_FORMAT
+#endif
+
+// Can we use SIMD intrinsics?
+// Define BOOST_STATIC_STRING_NO_SIMD to disable them.
+#ifndef BOOST_STATIC_STRING_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || \
+   (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_STATIC_STRING_HAS_SSE2
+#endif
+#if defined(__SSSE3__) || defined(__AVX__)
+#define BOOST_STATIC_STRING_HAS_SSSE3
+#endif
+#if defined(__AVX2__)
+#define BOOST_STATIC_STRING_HAS_AVX2
+#endif
+#endif
+
 // Check for an attribute
 #if defined(__has_cpp_attribute)
 #define BOOST_STATIC_STRING_CHECK_FOR_ATTR(x) __has_cpp_attribute(x)
@@ -146,8 +168,16 @@
 #define BOOST_STATIC_STRING_ASSERT(cond) BOOST_ASSERT(cond)
 #endif
 #else
+#if !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#define BOOST_STATIC_STRING_NO_EXCEPTIONS
+#endif
 #ifndef BOOST_STATIC_STRING_THROW
+#ifndef BOOST_STATIC_STRING_NO_EXCEPTIONS
 #define BOOST_STATIC_STRING_THROW(ex) throw ex
+#else
+// Without exceptions, an error that would throw aborts instead
+#define BOOST_STATIC_STRING_THROW(ex) std::abort()
+#endif
 #endif
 #ifndef BOOST_STATIC_STRING_STATIC_ASSERT
 #define BOOST_STATIC_STRING_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
@@ -166,6 +196,10 @@
 #include <boost/core/detail/string_view.hpp>
 #include <boost/throw_exception.hpp>
 
+#ifdef BOOST_NO_EXCEPTIONS
+#define BOOST_STATIC_STRING_NO_EXCEPTIONS
+#endif
+
 #if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW) || \
      defined(BOOST_STATIC_STRING_CXX17_STRING_VIEW)
 #include <string_view>
@@ -173,6 +207,7 @@
 #endif
 #else
 #include <cassert>
+#include <cstdlib>
 #include <stdexcept>
 
 /*
@@ -32,19 +32,74 @@
 #endif
 
 #include <algorithm>
+#include <cfloat>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <locale>
+#include <ostream>
 #include <iosfwd>
+#include <istream>
+#include <system_error>
 #include <type_traits>
+#include <utility>
+
+#ifdef BOOST_STATIC_STRING_HAS_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_SSSE3
+#include <tmmintrin.h>
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_FORMAT
+#include <format>
+#include <string_view>
+#endif
 
 namespace boost {
 namespace static_strings {
 
+//------------------------------------------------------------------------------
+//
+// Tags
+//
+//------------------------------------------------------------------------------
+
+/** Tag type used to request uninitialized storage.
+
+    Passing a value of this type to the constructor of
+    @ref basic_static_string constructs an empty string
+    whose characters past the null terminator are left
+    uninitialized.
+
+    @see uninitialized
+*/
+struct uninitialized_t
+{
+  explicit uninitialized_t() = default;
+};
+
+/// A tag object of type @ref uninitialized_t
+#ifdef BOOST_STATIC_STRING_CPP17
+inline
+#endif
+constexpr uninitialized_t uninitialized{};
+
 #ifndef BOOST_STATIC_STRING_DOCS
-template<std::size_t N, typename CharT, typename Traits>
+struct throw_on_overflow;
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy = throw_on_overflow>
 class basic_static_string;
 
 //------------------------------------------------------------------------------
@@ -85,6 +140,32 @@ using static_u8string =
 
 namespace detail {
 
+// This workaround is for gcc 5,
+// which prohibits throw expressions in constexpr
+// functions, but for some reason permits them in
+// constructors.
+#ifdef BOOST_STATIC_STRING_GCC5_BAD_CONSTEXPR
+template<typename Exception>
+struct throw_exception
+{
+  BOOST_STATIC_STRING_NORETURN
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  throw_exception(const char* msg)
+  {
+    BOOST_STATIC_STRING_THROW(Exception(msg));
+  }
+};
+#else
+template<typename Exception>
+BOOST_STATIC_STRING_NORETURN
+inline
+void
+throw_exception(const char* msg)
+{
+  BOOST_STATIC_STRING_THROW(Exception(msg));
+}
+#endif
+
 // Find the smallest width integral type that can hold a value as large as N (Glen Fernandes)
 template<std::size_t N>
 using smallest_width =
@@ -148,34 +229,38 @@ struct is_string_like<
 // data and size member functions, and use them directly for assignments.
 // Types convertible to basic_static_string are not considered viewable
 // to prevent any ambiguity during overload resolution.
-template<std::size_t N, typename T, typename CharT, typename Traits, typename = void>
+template<std::size_t N, typename T, typename CharT, typename Traits,
+  typename OverflowPolicy, typename = void>
 struct enable_if_viewable { };
 
-template<std::size_t N, typename T, typename CharT, typename Traits>
-struct enable_if_viewable<N, T, CharT, Traits,
+template<std::size_t N, typename T, typename CharT, typename Traits,
+  typename OverflowPolicy>
+struct enable_if_viewable<N, T, CharT, Traits, OverflowPolicy,
     typename std::enable_if<
 #if !defined(BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW)
         is_string_like<T, CharT>::value &&
-        !std::is_convertible<const T&, const basic_static_string<N, CharT, Traits>&>::value
+        !std::is_convertible<const T&, const basic_static_string<N, CharT, Traits, OverflowPolicy>&>::value
 #elif defined(BOOST_STATIC_STRING_STANDALONE)
         std::is_convertible<const T&, std::basic_string_view<CharT, Traits>>::value &&
         !std::is_convertible<const T&, const CharT*>::value &&
-        !std::is_convertible<const T&, const basic_static_string<N, CharT, Traits>&>::value
+        !std::is_convertible<const T&, const basic_static_string<N, CharT, Traits, OverflowPolicy>&>::value
 #else
         (
             std::is_convertible<const T&, basic_string_view<CharT, Traits>>::value ||
             std::is_convertible<const T&, core::basic_string_view<CharT>>::value
         ) &&
         !std::is_convertible<const T&, const CharT*>::value &&
-        !std::is_convertible<const T&, const basic_static_string<N, CharT, Traits>&>::value
+        !std::is_convertible<const T&, const basic_static_string<N, CharT, Traits, OverflowPolicy>&>::value
 #endif
     >::type>
 {
   using type = void;
 };
 
-template<std::size_t N, typename T, typename CharT, typename Traits>
-using enable_if_viewable_t = typename enable_if_viewable<N, T, CharT, Traits>::type;
+template<std::size_t N, typename T, typename CharT, typename Traits,
+  typename OverflowPolicy>
+using enable_if_viewable_t =
+  typename enable_if_viewable<N, T, CharT, Traits, OverflowPolicy>::type;
 
 // The common string_view type used in private operations with enable_if_viewable_t
 // - T const& itself when no string_view type is available
@@ -317,7 +402,24 @@ private:
   using const_pointer = const value_type*;
 public:
   BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  static_string_base() noexcept { };
+  static_string_base() noexcept
+    : data_{} { }
+
+  // Only constexpr in C++20, since earlier standards
+  // require every member to be initialized.
+  BOOST_STATIC_STRING_CPP20_CONSTEXPR
+  explicit
+  static_string_base(uninitialized_t) noexcept
+  {
+#if defined(BOOST_STATIC_STRING_CPP20) && \
+defined(BOOST_STATIC_STRING_IS_CONST_EVAL)
+    // Reading an uninitialized object is not a constant
+    // expression, so we still fill the buffer in that case.
+    if (BOOST_STATIC_STRING_IS_CONST_EVAL)
+      for (auto& c : data_)
+        Traits::assign(c, value_type());
+#endif
+  }
 
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   pointer
@@ -360,7 +462,7 @@ public:
 
   size_type size_ = 0;
 
-  value_type data_[N + 1]{};
+  value_type data_[N + 1];
 };
 
 // Optimization for when the size is 0
@@ -374,6 +476,10 @@ public:
   BOOST_STATIC_STRING_CPP11_CONSTEXPR
   static_string_base() noexcept { }
 
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  explicit
+  static_string_base(uninitialized_t) noexcept { }
+
   // Modifying the null terminator is UB
   BOOST_STATIC_STRING_CPP11_CONSTEXPR
   pointer
@@ -434,142 +540,300 @@ lexicographical_compare(
   return Traits::compare(s1, s2, n1);
 }
 
-template<typename Traits, typename Integer>
+// The two digit decimal representations of 0 to 99
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
 inline
-char*
-integer_to_string(
-  char* str_end,
-  Integer value,
-  std::true_type) noexcept
+const char*
+digit_pairs() noexcept
+{
+  return
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+}
+
+// Writes the decimal digits of value backwards from str_end,
+// two at a time, and returns a pointer to the first digit.
+template<typename CharT, typename Unsigned>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+CharT*
+unsigned_to_string(
+  CharT* str_end,
+  Unsigned value) noexcept
 {
-  if (value == 0)
+  const char* const pairs = digit_pairs();
+  while (value >= 100)
   {
-    Traits::assign(*--str_end, '0');
-    return str_end;
+    const auto i = static_cast<std::size_t>(value % 100) * 2;
+    value /= 100;
+    *--str_end = static_cast<CharT>(pairs[i + 1]);
+    *--str_end = static_cast<CharT>(pairs[i]);
   }
-  if (value < 0)
+  if (value >= 10)
   {
-    const bool is_min = value == (std::numeric_limits<Integer>::min)();
-    // negation of a min value cannot be represented
-    if (is_min)
-      value = (std::numeric_limits<Integer>::max)();
-    else
-      value = -value;
-    const auto last_char = str_end - 1;
-    for (; value > 0; value /= 10)
-      Traits::assign(*--str_end, "0123456789"[value % 10]);
-    // minimum values are powers of 2, so it will
-    // never terminate with a 9.
-    if (is_min)
-      Traits::assign(*last_char, Traits::to_char_type(
-        Traits::to_int_type(*last_char) + 1));
-    Traits::assign(*--str_end, '-');
-    return str_end;
+    const auto i = static_cast<std::size_t>(value) * 2;
+    *--str_end = static_cast<CharT>(pairs[i + 1]);
+    *--str_end = static_cast<CharT>(pairs[i]);
   }
-  for (; value > 0; value /= 10)
-    Traits::assign(*--str_end, "0123456789"[value % 10]);
+  else
+    *--str_end = static_cast<CharT>('0' + static_cast<int>(value));
   return str_end;
 }
 
-template<typename Traits, typename Integer>
+// The digits of the bases up to 36
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
 inline
-char*
-integer_to_string(
-  char* str_end,
-  Integer value,
-  std::false_type) noexcept
+const char*
+digit_chars() noexcept
 {
-  if (value == 0)
-  {
-    Traits::assign(*--str_end, '0');
+  return "0123456789abcdefghijklmnopqrstuvwxyz";
+}
+
+// Writes the digits of value in base backwards from str_end
+// and returns a pointer to the first digit. Bases which are
+// powers of two take the digits from the bits of value.
+template<typename CharT, typename Unsigned>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+CharT*
+unsigned_to_string(
+  CharT* str_end,
+  Unsigned value,
+  unsigned base) noexcept
+{
+  if (base == 10)
+    return unsigned_to_string(str_end, value);
+  const char* const digits = digit_chars();
+  if (!(base & (base - 1)))
+  {
+    unsigned shift = 0;
+    while ((1u << shift) != base)
+      ++shift;
+    do
+    {
+      *--str_end = static_cast<CharT>(digits[value & (base - 1)]);
+      value = static_cast<Unsigned>(value >> shift);
+    }
+    while (value);
     return str_end;
   }
-  for (; value > 0; value /= 10)
-    Traits::assign(*--str_end, "0123456789"[value % 10]);
+  do
+  {
+    *--str_end = static_cast<CharT>(digits[value % base]);
+    value = static_cast<Unsigned>(value / base);
+  }
+  while (value);
   return str_end;
 }
 
-template<typename Traits, typename Integer>
+template<typename CharT, typename Integer>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
-wchar_t*
-integer_to_wstring(
-  wchar_t* str_end,
+CharT*
+integer_to_string(
+  CharT* str_end,
   Integer value,
   std::true_type) noexcept
 {
-  if (value == 0)
+  using unsigned_type = typename std::make_unsigned<Integer>::type;
+  // negating in the unsigned type is also
+  // correct for the minimum value
+  if (value < 0)
   {
-    Traits::assign(*--str_end, L'0');
+    str_end = unsigned_to_string(str_end,
+      static_cast<unsigned_type>(0u - static_cast<unsigned_type>(value)));
+    *--str_end = static_cast<CharT>('-');
     return str_end;
   }
+  return unsigned_to_string(str_end, static_cast<unsigned_type>(value));
+}
+
+template<typename CharT, typename Integer>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+CharT*
+integer_to_string(
+  CharT* str_end,
+  Integer value,
+  std::false_type) noexcept
+{
+  return unsigned_to_string(str_end, value);
+}
+
+template<typename CharT, typename Integer>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+CharT*
+integer_to_string(
+  CharT* str_end,
+  Integer value,
+  unsigned base,
+  std::true_type) noexcept
+{
+  using unsigned_type = typename std::make_unsigned<Integer>::type;
   if (value < 0)
   {
-    const bool is_min = value == (std::numeric_limits<Integer>::min)();
-    // negation of a min value cannot be represented
-    if (is_min)
-      value = (std::numeric_limits<Integer>::max)();
-    else
-      value = -value;
-    const auto last_char = str_end - 1;
-    for (; value > 0; value /= 10)
-      Traits::assign(*--str_end, L"0123456789"[value % 10]);
-    // minimum values are powers of 2, so it will
-    // never terminate with a 9.
-    if (is_min)
-      Traits::assign(*last_char, Traits::to_char_type(
-        Traits::to_int_type(*last_char) + 1));
-    Traits::assign(*--str_end, L'-');
+    str_end = unsigned_to_string(str_end,
+      static_cast<unsigned_type>(0u - static_cast<unsigned_type>(value)),
+      base);
+    *--str_end = static_cast<CharT>('-');
     return str_end;
   }
-  for (; value > 0; value /= 10)
-    Traits::assign(*--str_end, L"0123456789"[value % 10]);
-  return str_end;
+  return unsigned_to_string(
+    str_end, static_cast<unsigned_type>(value), base);
 }
 
-template<typename Traits, typename Integer>
+template<typename CharT, typename Integer>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
-wchar_t*
-integer_to_wstring(
-  wchar_t* str_end,
+CharT*
+integer_to_string(
+  CharT* str_end,
   Integer value,
+  unsigned base,
   std::false_type) noexcept
 {
-  if (value == 0)
+  return unsigned_to_string(str_end, value, base);
+}
+
+// Grants the non-member functions which build a
+// string in place access to its size.
+struct string_access
+{
+  template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+  static
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  set_size(
+    basic_static_string<N, CharT, Traits, OverflowPolicy>& s,
+    std::size_t n) noexcept
   {
-    Traits::assign(*--str_end, L'0');
-    return str_end;
+    s.set_size(n);
+    s.term();
   }
-  for (; value > 0; value /= 10)
-    Traits::assign(*--str_end, L"0123456789"[value % 10]);
-  return str_end;
-}
+
+  // Reports an overflow through the policy of s
+  template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+  static
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  report_overflow(
+    basic_static_string<N, CharT, Traits, OverflowPolicy>& s,
+    const char* msg)
+  {
+    s.report_overflow(msg);
+  }
+
+  // Returns the part of count which fits in avail,
+  // reporting an overflow through the policy of s
+  template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+  static
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  std::size_t
+  checked_count(
+    basic_static_string<N, CharT, Traits, OverflowPolicy>& s,
+    std::size_t count,
+    std::size_t avail,
+    const char* msg)
+  {
+    return s.checked_count(count, avail, msg);
+  }
+
+  // Returns a string holding {first, last), which is
+  // known to fit, without going through a capacity check
+  template<typename String, typename CharT>
+  static
+  BOOST_STATIC_STRING_CPP20_CONSTEXPR
+  String
+  make(
+    const CharT* first,
+    const CharT* last) noexcept
+  {
+    String s(uninitialized);
+    String::traits_type::copy(s.data(), first, last - first);
+    set_size(s, last - first);
+    return s;
+  }
+};
 
 template<std::size_t N, typename Integer>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 inline
 static_string<N>
 to_static_string_int_impl(Integer value) noexcept
 {
   char buffer[N];
-  const auto digits_end = std::end(buffer);
-  const auto digits_begin = integer_to_string<std::char_traits<char>, Integer>(
+  const auto digits_end = buffer + N;
+  const auto digits_begin = integer_to_string(
     digits_end, value, std::is_signed<Integer>{});
-  return static_string<N>(digits_begin, std::distance(digits_begin, digits_end));
+  return string_access::make<static_string<N>>(digits_begin, digits_end);
 }
 
 #ifdef BOOST_STATIC_STRING_HAS_WCHAR
 template<std::size_t N, typename Integer>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 inline
 static_wstring<N>
 to_static_wstring_int_impl(Integer value) noexcept
 {
   wchar_t buffer[N];
-  const auto digits_end = std::end(buffer);
-  const auto digits_begin = integer_to_wstring<std::char_traits<wchar_t>, Integer>(
+  const auto digits_end = buffer + N;
+  const auto digits_begin = integer_to_string(
     digits_end, value, std::is_signed<Integer>{});
-  return static_wstring<N>(digits_begin, std::distance(digits_begin, digits_end));
+  return string_access::make<static_wstring<N>>(digits_begin, digits_end);
 }
 #endif
 
+// Formats value in base, padded with fill on the left to at
+// least width characters. Zeros are put after the sign, like
+// printf does, and width is limited to N.
+template<std::size_t N, typename CharT, typename Integer>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+basic_static_string<N, CharT, std::char_traits<CharT>>
+to_static_string_int_impl(
+  Integer value,
+  int base,
+  std::size_t width,
+  CharT fill)
+{
+  if (base < 2 || base > 36)
+    throw_exception<std::invalid_argument>(
+      "base < 2 || base > 36");
+  CharT buffer[N];
+  const auto digits_end = buffer + N;
+  auto digits_begin = integer_to_string(
+    digits_end, value, unsigned(base), std::is_signed<Integer>{});
+  if (width > N)
+    width = N;
+  if (std::size_t(digits_end - digits_begin) < width)
+  {
+    const auto padded_begin = digits_end - width;
+    auto it = padded_begin;
+    if (fill == CharT('0') && *digits_begin == CharT('-'))
+    {
+      *it++ = *digits_begin++;
+    }
+    while (it != digits_begin)
+      *it++ = fill;
+    digits_begin = padded_begin;
+  }
+  return string_access::make<
+    basic_static_string<N, CharT, std::char_traits<CharT>>>(
+      digits_begin, digits_end);
+}
+
 BOOST_STATIC_STRING_CPP11_CONSTEXPR
 inline
 int
@@ -578,6 +842,57 @@ count_digits(std::size_t value)
   return value < 10 ? 1 : count_digits(value / 10) + 1;
 }
 
+// The number of digits of value in base
+template<typename Unsigned>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+std::size_t
+count_digits(
+  Unsigned value,
+  unsigned base) noexcept
+{
+  std::size_t n = 1;
+  if (base == 10)
+  {
+    for (;; value = static_cast<Unsigned>(value / 10000), n += 4)
+    {
+      if (value < 10)
+        return n;
+      if (value < 100)
+        return n + 1;
+      if (value < 1000)
+        return n + 2;
+      if (value < 10000)
+        return n + 3;
+    }
+  }
+  for (; value >= base; value = static_cast<Unsigned>(value / base))
+    ++n;
+  return n;
+}
+
+template<typename Integer>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
+inline
+bool
+is_negative(
+  Integer value,
+  std::true_type) noexcept
+{
+  return value < 0;
+}
+
+template<typename Integer>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
+inline
+bool
+is_negative(
+  Integer,
+  std::false_type) noexcept
+{
+  return false;
+}
+
 // Ignore -Wformat-truncation, we know what
 // we are doing here. The version check does
 // not need to be extremely precise.
@@ -586,35 +901,6 @@ count_digits(std::size_t value)
 #pragma GCC diagnostic ignored "-Wformat-truncation"
 #endif
 
-template<std::size_t N>
-inline
-static_string<N>
-to_static_string_float_impl(double value) noexcept
-{
-  // we have to assume here that no reasonable implementation
-  // will require more than 2^63 chars to represent a float value.
-  const long long narrow =
-    static_cast<long long>(N);
-  // extra one needed for null terminator
-  char buffer[N + 1];
-  // we know that a formatting error will not occur, so
-  // we assume that the result is always positive
-  if (std::size_t(std::snprintf(buffer, N + 1, "%f", value)) > N)
-  {
-    // the + 4 is for the decimal, 'e',
-    // its sign, and the sign of the integral portion
-    const int reserved_count =
-      (std::max)(2, count_digits(
-      std::numeric_limits<double>::max_exponent10)) + 4;
-    const int precision = narrow > reserved_count ?
-      N - reserved_count : 0;
-    // switch to scientific notation
-    std::snprintf(buffer, N + 1, "%.*e", precision, value);
-  }
-  // this will not throw
-  return static_string<N>(buffer);
-}
-
 template<std::size_t N>
 inline
 static_string<N>
@@ -642,48 +928,11 @@ to_static_string_float_impl(long double value) noexcept
     // switch to scientific notation
     std::snprintf(buffer, N + 1, "%.*Le", precision, value);
   }
-  // this will not throw
-  return static_string<N>(buffer);
+  return string_access::make<static_string<N>>(
+    buffer, buffer + std::char_traits<char>::length(buffer));
 }
 
 #ifdef BOOST_STATIC_STRING_HAS_WCHAR
-template<std::size_t N>
-inline
-static_wstring<N>
-to_static_wstring_float_impl(double value) noexcept
-{
-  // we have to assume here that no reasonable implementation
-  // will require more than 2^63 chars to represent a float value.
-  const long long narrow =
-    static_cast<long long>(N);
-  // extra one needed for null terminator
-  wchar_t buffer[N + 1];
-  // swprintf returns a negative number if it can't
-  // fit all the characters in the buffer.
-  // mingw has a non-standard swprintf, so
-  // this just covers all the bases. short
-  // circuit evaluation will ensure that the
-  // second operand is not evaluated on conforming
-  // implementations.
-  const long long num_written =
-    std::swprintf(buffer, N + 1, L"%f", value);
-  if (num_written < 0 ||
-    num_written > narrow)
-  {
-    // the + 4 is for the decimal, 'e',
-    // its sign, and the sign of the integral portion
-    const int reserved_count =
-      (std::max)(2, count_digits(
-      std::numeric_limits<double>::max_exponent10)) + 4;
-    const int precision = narrow > reserved_count ?
-      N - reserved_count : 0;
-    // switch to scientific notation
-    std::swprintf(buffer, N + 1, L"%.*e", precision, value);
-  }
-  // this will not throw
-  return static_wstring<N>(buffer);
-}
-
 template<std::size_t N>
 inline
 static_wstring<N>
@@ -717,8 +966,8 @@ to_static_wstring_float_impl(long double value) noexcept
     // switch to scientific notation
     std::swprintf(buffer, N + 1, L"%.*Le", precision, value);
   }
-  // this will not throw
-  return static_wstring<N>(buffer);
+  return string_access::make<static_wstring<N>>(
+    buffer, buffer + std::char_traits<wchar_t>::length(buffer));
 }
 #endif
 
@@ -726,22 +975,6 @@ to_static_wstring_float_impl(long double value) noexcept
 #pragma GCC diagnostic pop
 #endif
 
-template<typename Traits, typename CharT, typename ForwardIterator>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-ForwardIterator
-find_not_of(
-  ForwardIterator first,
-  ForwardIterator last,
-  const CharT* str,
-  std::size_t n) noexcept
-{
-  for (; first != last; ++first)
-    if (!Traits::find(str, n, *first))
-      return first;
-  return last;
-}
-
 // constexpr search for C++14
 template<typename ForwardIt1, typename ForwardIt2, typename BinaryPredicate>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
@@ -769,5350 +1002,10690 @@ search(
   }
 }
 
-template<typename InputIt, typename ForwardIt, typename BinaryPredicate>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
+// The optimized search routines below are used at run time
+// for std::char_traits of the standard character types, for
+// which eq compares the integer values of the characters.
+template<typename Traits, typename CharT = typename Traits::char_type>
+struct is_fast_traits
+  : std::integral_constant<bool,
+      std::is_same<Traits, std::char_traits<CharT>>::value &&
+      std::is_integral<CharT>::value &&
+      (sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4)> { };
+
+// Unsigned integer type with the same size as a character
+template<std::size_t Size>
+struct lane_uint;
+
+template<>
+struct lane_uint<1> { using type = std::uint8_t; };
+
+template<>
+struct lane_uint<2> { using type = std::uint16_t; };
+
+template<>
+struct lane_uint<4> { using type = std::uint32_t; };
+
+// Index of the lowest set bit, x shall not be zero
 inline
-InputIt
-find_first_of(
-  InputIt first,
-  InputIt last,
-  ForwardIt s_first,
-  ForwardIt s_last,
-  BinaryPredicate p)
+unsigned
+countr_zero(std::uint32_t x) noexcept
 {
-  for (; first != last; ++first)
-    for (ForwardIt it = s_first; it != s_last; ++it)
-      if (p(*first, *it))
-        return first;
-  return last;
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctz(x));
+#elif defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, x);
+  return static_cast<unsigned>(index);
+#else
+  unsigned n = 0;
+  for (; !(x & 1); x >>= 1, ++n);
+  return n;
+#endif
 }
 
-// KRYSTIAN TODO: add a constexpr rotate
+// Index of the highest set bit, x shall not be zero
+inline
+unsigned
+highest_bit(std::uint32_t x) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return 31 - static_cast<unsigned>(__builtin_clz(x));
+#elif defined(_MSC_VER)
+  unsigned long index;
+  _BitScanReverse(&index, x);
+  return static_cast<unsigned>(index);
+#else
+  unsigned n = 0;
+  for (; x >>= 1; ++n);
+  return n;
+#endif
+}
 
-// Check if a pointer lies within the range {src_first, src_last)
-// without unspecified behavior, allowing it to be used
-// in a constant evaluation.
-template<typename T>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
+// Vector compare masks have sizeof(CharT) bits per character,
+// this keeps only the lowest bit of each one.
+template<typename CharT>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
 inline
-bool
-ptr_in_range(
-  const T* src_first,
-  const T* src_last,
-  const T* ptr)
+std::uint32_t
+lane_bits() noexcept
 {
-#if defined(BOOST_STATIC_STRING_CPP14) && \
-defined(BOOST_STATIC_STRING_IS_CONST_EVAL)
-  // Our second best option is to use is_constant_evaluated
-  // and a loop that checks for equality, since equality for
-  // pointer to object types is never unspecified in this case.
-  if (BOOST_STATIC_STRING_IS_CONST_EVAL)
-  {
-    for (; src_first != src_last; ++src_first)
-      if (ptr == src_first)
-        return true;
-    return false;
-  }
-#endif
-  // We want to make this usable in constant expressions as much as possible
-  // while retaining the guarentee that the comparison has a strict total ordering.
-  // We also want this to be fast. Since different compilers have differing levels
-  // of conformance, we will settle for the best option that is available.
-  // We don't care about this in C++11, since this function would have
-  // no applications in constant expressions.
-#if defined(BOOST_STATIC_STRING_CPP14) && \
-defined(BOOST_STATIC_STRING_NO_PTR_COMP_FUNCTIONS)
-  // If library comparison functions don't work,
-  // we can use try builtin comparison operators instead.
-  return ptr >= src_first && ptr < src_last;
-#else
-  // Use the library comparison functions if we can't use
-  // is_constant_evaluated or if we don't need to.
-  return std::greater_equal<const T*>()(ptr, src_first) &&
-    std::less<const T*>()(ptr, src_last);
-#endif
+  return 0xffffffffu / ((1u << sizeof(CharT)) - 1);
 }
 
-// This workaround is for gcc 5,
-// which prohibits throw expressions in constexpr
-// functions, but for some reason permits them in
-// constructors.
-#ifdef BOOST_STATIC_STRING_GCC5_BAD_CONSTEXPR
-template<typename Exception>
-struct throw_exception
+// SWAR operations on 64-bit words holding 8 / sizeof(CharT) characters.
+// memcpy is used for loads to avoid alignment and aliasing issues.
+template<typename CharT>
+inline
+std::uint64_t
+load_word(const CharT* p) noexcept
 {
-  BOOST_STATIC_STRING_NORETURN
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  throw_exception(const char* msg)
-  {
-    BOOST_STATIC_STRING_THROW(Exception(msg));
-  }
-};
-#else
-template<typename Exception>
-BOOST_STATIC_STRING_NORETURN
+  std::uint64_t w;
+  std::memcpy(&w, p, sizeof(w));
+  return w;
+}
+
+template<typename CharT>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
 inline
-void
-throw_exception(const char* msg)
+std::uint64_t
+word_ones() noexcept
 {
-  BOOST_STATIC_STRING_THROW(Exception(msg));
+  return ~std::uint64_t(0) / (std::numeric_limits<
+    typename lane_uint<sizeof(CharT)>::type>::max)();
 }
-#endif
 
-} // detail
-#endif
+template<typename CharT>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
+inline
+std::uint64_t
+word_high() noexcept
+{
+  return word_ones<CharT>() << (sizeof(CharT) * 8 - 1);
+}
 
-//--------------------------------------------------------------------------
-//
-// static_string
-//
-//--------------------------------------------------------------------------
+template<typename CharT>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
+inline
+std::uint64_t
+broadcast_word(CharT c) noexcept
+{
+  return word_ones<CharT>() * static_cast<
+    typename lane_uint<sizeof(CharT)>::type>(c);
+}
 
-/** A fixed-capacity string.
+// Returns a word with the high bit set in exactly
+// those characters of x which are zero.
+template<typename CharT>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
+inline
+std::uint64_t
+zero_lanes(std::uint64_t x) noexcept
+{
+  return ~(((x & ~word_high<CharT>()) + ~word_high<CharT>()) |
+    x | ~word_high<CharT>());
+}
 
-    These objects behave like `std::string` except that the storage
-    is not dynamically allocated but rather fixed in size, and
-    stored in the object itself.
+// Whether the character at index i of a word returned
+// by zero_lanes is set. Copying the word back out
+// preserves memory order regardless of endianness.
+template<typename CharT>
+inline
+bool
+lane_set(std::uint64_t w, std::size_t i) noexcept
+{
+  typename lane_uint<sizeof(CharT)>::type lanes[8 / sizeof(CharT)];
+  std::memcpy(lanes, &w, sizeof(lanes));
+  return lanes[i] != 0;
+}
 
-    These strings offer performance advantages when an algorithm
-    can execute with a reasonable upper limit on the size of a value.
+#ifdef BOOST_STATIC_STRING_HAS_SSE2
+template<typename CharT>
+inline
+__m128i
+broadcast_sse2(CharT c) noexcept
+{
+  return sizeof(CharT) == 1 ? _mm_set1_epi8(static_cast<char>(c)) :
+    sizeof(CharT) == 2 ? _mm_set1_epi16(static_cast<short>(c)) :
+      _mm_set1_epi32(static_cast<int>(c));
+}
 
-    @par Aliases
+// Mask of the characters in {p, p + 16 / sizeof(CharT)) equal to v
+template<typename CharT>
+inline
+std::uint32_t
+match_sse2(const CharT* p, __m128i v) noexcept
+{
+  const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(
+    sizeof(CharT) == 1 ? _mm_cmpeq_epi8(b, v) :
+      sizeof(CharT) == 2 ? _mm_cmpeq_epi16(b, v) :
+        _mm_cmpeq_epi32(b, v)));
+}
+#endif
 
-    The following alias templates are provided for convenience:
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+template<typename CharT>
+inline
+__m256i
+broadcast_avx2(CharT c) noexcept
+{
+  return sizeof(CharT) == 1 ? _mm256_set1_epi8(static_cast<char>(c)) :
+    sizeof(CharT) == 2 ? _mm256_set1_epi16(static_cast<short>(c)) :
+      _mm256_set1_epi32(static_cast<int>(c));
+}
 
-    @code
-    template<std::size_t N>
-    using static_string =
-      basic_static_string<N, char, std::char_traits<char>>;
-    @endcode
+// Mask of the characters in {p, p + 32 / sizeof(CharT)) equal to v
+template<typename CharT>
+inline
+std::uint32_t
+match_avx2(const CharT* p, __m256i v) noexcept
+{
+  const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(
+    sizeof(CharT) == 1 ? _mm256_cmpeq_epi8(b, v) :
+      sizeof(CharT) == 2 ? _mm256_cmpeq_epi16(b, v) :
+        _mm256_cmpeq_epi32(b, v)));
+}
+#endif
 
-    @code
-    template<std::size_t N>
-    using static_wstring =
-      basic_static_string<N, wchar_t, std::char_traits<wchar_t>>;
-    @endcode
+// Find the first character in {first, first + n) that is equal
+// to c if Equal is true, or not equal to c otherwise.
+// Returns first + n if there is none.
+template<bool Equal, typename CharT>
+inline
+const CharT*
+find_char_fast(
+  const CharT* first,
+  std::size_t n,
+  CharT c) noexcept
+{
+  std::size_t i = 0;
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+  {
+    constexpr std::size_t width = 32 / sizeof(CharT);
+    const __m256i v = broadcast_avx2(c);
+    for (; n - i >= width; i += width)
+    {
+      std::uint32_t mask = match_avx2(first + i, v);
+      if (!Equal)
+        mask = ~mask;
+      if (mask)
+        return first + i + countr_zero(mask) / sizeof(CharT);
+    }
+  }
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_SSE2
+  {
+    constexpr std::size_t width = 16 / sizeof(CharT);
+    const __m128i v = broadcast_sse2(c);
+    for (; n - i >= width; i += width)
+    {
+      std::uint32_t mask = match_sse2(first + i, v);
+      if (!Equal)
+        mask = ~mask & 0xffff;
+      if (mask)
+        return first + i + countr_zero(mask) / sizeof(CharT);
+    }
+  }
+#endif
+  {
+    constexpr std::size_t width = 8 / sizeof(CharT);
+    const std::uint64_t w = broadcast_word(c);
+    for (; n - i >= width; i += width)
+    {
+      std::uint64_t hits = zero_lanes<CharT>(load_word(first + i) ^ w);
+      if (!Equal)
+        hits ^= word_high<CharT>();
+      if (!hits)
+        continue;
+      for (std::size_t j = 0; j < width; ++j)
+        if (lane_set<CharT>(hits, j))
+          return first + i + j;
+    }
+  }
+  for (; i < n; ++i)
+    if ((first[i] == c) == Equal)
+      return first + i;
+  return first + n;
+}
 
-    @code
-    template<std::size_t N>
-    using static_u16string =
-      basic_static_string<N, char16_t, std::char_traits<char16_t>>;
-    @endcode
+// Find the last character in {first, first + n) that is equal
+// to c if Equal is true, or not equal to c otherwise.
+// Returns first + n if there is none.
+template<bool Equal, typename CharT>
+inline
+const CharT*
+rfind_char_fast(
+  const CharT* first,
+  std::size_t n,
+  CharT c) noexcept
+{
+  // the number of characters left to search
+  std::size_t i = n;
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+  {
+    constexpr std::size_t width = 32 / sizeof(CharT);
+    const __m256i v = broadcast_avx2(c);
+    for (; i >= width; i -= width)
+    {
+      std::uint32_t mask = match_avx2(first + i - width, v);
+      if (!Equal)
+        mask = ~mask;
+      if (mask)
+        return first + i - width + highest_bit(mask) / sizeof(CharT);
+    }
+  }
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_SSE2
+  {
+    constexpr std::size_t width = 16 / sizeof(CharT);
+    const __m128i v = broadcast_sse2(c);
+    for (; i >= width; i -= width)
+    {
+      std::uint32_t mask = match_sse2(first + i - width, v);
+      if (!Equal)
+        mask = ~mask & 0xffff;
+      if (mask)
+        return first + i - width + highest_bit(mask) / sizeof(CharT);
+    }
+  }
+#endif
+  {
+    constexpr std::size_t width = 8 / sizeof(CharT);
+    const std::uint64_t w = broadcast_word(c);
+    for (; i >= width; i -= width)
+    {
+      std::uint64_t hits = zero_lanes<CharT>(load_word(first + i - width) ^ w);
+      if (!Equal)
+        hits ^= word_high<CharT>();
+      if (!hits)
+        continue;
+      for (std::size_t j = width; j-- > 0;)
+        if (lane_set<CharT>(hits, j))
+          return first + i - width + j;
+    }
+  }
+  while (i-- > 0)
+    if ((first[i] == c) == Equal)
+      return first + i;
+  return first + n;
+}
 
-    @code
-    template<std::size_t N>
-    using static_u32string =
-      basic_static_string<N, char32_t, std::char_traits<char32_t>>;
-    @endcode
+// Substring search filtering candidate positions by comparing the
+// first and last characters of the needle against a block of the
+// haystack at once. Candidates are then verified by comparing
+// the middle. If Reverse is true, the last match is found.
+// Returns first + len if there is none. Requires 1 < n <= len.
+template<bool Reverse, typename CharT>
+inline
+const CharT*
+search_fast(
+  const CharT* first,
+  std::size_t len,
+  const CharT* s,
+  std::size_t n) noexcept
+{
+  // the number of positions a match can start at
+  const std::size_t count = len - n + 1;
+  const CharT* const tail = first + (n - 1);
+  const std::size_t mid_bytes = (n - 2) * sizeof(CharT);
+  // the positions which remain to be searched are
+  // {lo, hi), blocks are taken from the front
+  // or back depending on the direction
+  std::size_t lo = 0;
+  std::size_t hi = count;
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+  {
+    constexpr std::size_t width = 32 / sizeof(CharT);
+    const __m256i vf = broadcast_avx2(s[0]);
+    const __m256i vl = broadcast_avx2(s[n - 1]);
+    for (; hi - lo >= width; Reverse ? hi -= width : lo += width)
+    {
+      const std::size_t i = Reverse ? hi - width : lo;
+      std::uint32_t mask = match_avx2(first + i, vf) &
+        match_avx2(tail + i, vl) & lane_bits<CharT>();
+      while (mask)
+      {
+        const unsigned bit = Reverse ? highest_bit(mask) : countr_zero(mask);
+        const std::size_t pos = i + bit / sizeof(CharT);
+        if (!std::memcmp(first + pos + 1, s + 1, mid_bytes))
+          return first + pos;
+        mask &= ~(std::uint32_t(1) << bit);
+      }
+    }
+  }
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_SSE2
+  {
+    constexpr std::size_t width = 16 / sizeof(CharT);
+    const __m128i vf = broadcast_sse2(s[0]);
+    const __m128i vl = broadcast_sse2(s[n - 1]);
+    for (; hi - lo >= width; Reverse ? hi -= width : lo += width)
+    {
+      const std::size_t i = Reverse ? hi - width : lo;
+      std::uint32_t mask = match_sse2(first + i, vf) &
+        match_sse2(tail + i, vl) & lane_bits<CharT>();
+      while (mask)
+      {
+        const unsigned bit = Reverse ? highest_bit(mask) : countr_zero(mask);
+        const std::size_t pos = i + bit / sizeof(CharT);
+        if (!std::memcmp(first + pos + 1, s + 1, mid_bytes))
+          return first + pos;
+        mask &= ~(std::uint32_t(1) << bit);
+      }
+    }
+  }
+#endif
+  {
+    constexpr std::size_t width = 8 / sizeof(CharT);
+    const std::uint64_t wf = broadcast_word(s[0]);
+    const std::uint64_t wl = broadcast_word(s[n - 1]);
+    for (; hi - lo >= width; Reverse ? hi -= width : lo += width)
+    {
+      const std::size_t i = Reverse ? hi - width : lo;
+      const std::uint64_t hits = zero_lanes<CharT>(
+        (load_word(first + i) ^ wf) | (load_word(tail + i) ^ wl));
+      if (!hits)
+        continue;
+      for (std::size_t k = 0; k < width; ++k)
+      {
+        const std::size_t j = Reverse ? width - 1 - k : k;
+        if (lane_set<CharT>(hits, j) &&
+            !std::memcmp(first + i + j + 1, s + 1, mid_bytes))
+          return first + i + j;
+      }
+    }
+  }
+  for (; lo < hi; Reverse ? --hi : ++lo)
+  {
+    const std::size_t i = Reverse ? hi - 1 : lo;
+    if (first[i] == s[0] && tail[i] == s[n - 1] &&
+        !std::memcmp(first + i + 1, s + 1, mid_bytes))
+      return first + i;
+  }
+  return first + len;
+}
 
-    Addtionally, the alias template `static_u8string` is provided in C++20
+// constexpr reverse search, finds the last occurrence
+// of {s, s + n) within {first, last) or returns last.
+// Requires 0 < n <= last - first.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+rsearch(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n) noexcept
+{
+  for (auto sub = last - n; ; --sub)
+  {
+    if (!Traits::compare(sub, s, n))
+      return sub;
+    if (sub == first)
+      return last;
+  }
+}
 
-    @code
-    template<std::size_t N>
-    using static_u8string =
-      basic_static_string<N, char8_t, std::char_traits<char8_t>>;
-    @endcode
+template<bool Reverse, typename Traits, typename CharT>
+inline
+const CharT*
+search_chars_runtime(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n,
+  std::false_type) noexcept
+{
+  return Reverse ?
+    rsearch<Traits>(first, last, s, n) :
+    search(first, last, s, s + n, Traits::eq);
+}
 
-    @see to_static_string
-*/
-template<std::size_t N, typename CharT,
-  typename Traits = std::char_traits<CharT>>
-class basic_static_string
-#ifndef BOOST_STATIC_STRING_DOCS
-  : private detail::static_string_base<N, CharT, Traits>
-#endif
+template<bool Reverse, typename Traits, typename CharT>
+inline
+const CharT*
+search_chars_runtime(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n,
+  std::true_type) noexcept
 {
-private:
-  template<std::size_t, class, class>
-  friend class basic_static_string;
-public:
-  //--------------------------------------------------------------------------
-  //
-  // Member types
-  //
-  //--------------------------------------------------------------------------
+  const std::size_t len = last - first;
+  if (n > 1)
+    return search_fast<Reverse>(first, len, s, n);
+  if (Reverse)
+    return rfind_char_fast<true>(first, len, *s);
+  if (sizeof(CharT) == 1)
+  {
+    // memchr is hard to beat
+    const auto res = Traits::find(first, len, *s);
+    return res ? res : last;
+  }
+  return find_char_fast<true>(first, len, *s);
+}
 
-  /// The traits type.
-  using traits_type = Traits;
+// Find the first occurrence of {s, s + n) within {first, last).
+// Returns last if there is none. Requires 0 < n <= last - first.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+search_chars(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n) noexcept
+{
+#ifdef BOOST_STATIC_STRING_IS_CONST_EVAL
+  if (!BOOST_STATIC_STRING_IS_CONST_EVAL)
+    return search_chars_runtime<false, Traits>(
+      first, last, s, n, is_fast_traits<Traits>{});
+#endif
+  return search(first, last, s, s + n, Traits::eq);
+}
 
-  /// The character type.
-  using value_type = typename traits_type::char_type;
+// Find the last occurrence of {s, s + n) within {first, last).
+// Returns last if there is none. Requires 0 < n <= last - first.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+rsearch_chars(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n) noexcept
+{
+#ifdef BOOST_STATIC_STRING_IS_CONST_EVAL
+  if (!BOOST_STATIC_STRING_IS_CONST_EVAL)
+    return search_chars_runtime<true, Traits>(
+      first, last, s, n, is_fast_traits<Traits>{});
+#endif
+  return rsearch<Traits>(first, last, s, n);
+}
 
-  /// The size type.
-  using size_type = std::size_t;
+template<typename Traits, typename CharT>
+inline
+const CharT*
+rfind_not_char_runtime(
+  const CharT* first,
+  const CharT* last,
+  CharT c,
+  std::false_type) noexcept
+{
+  for (auto it = last; it != first;)
+    if (!Traits::eq(*--it, c))
+      return it;
+  return last;
+}
 
-  /// The difference type.
-  using difference_type = std::ptrdiff_t;
+template<typename Traits, typename CharT>
+inline
+const CharT*
+rfind_not_char_runtime(
+  const CharT* first,
+  const CharT* last,
+  CharT c,
+  std::true_type) noexcept
+{
+  return rfind_char_fast<false>(first, last - first, c);
+}
 
-  /// The pointer type.
-  using pointer = value_type*;
+// Find the last character in {first, last) not equal
+// to c. Returns last if there is none.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+rfind_not_char(
+  const CharT* first,
+  const CharT* last,
+  CharT c) noexcept
+{
+#ifdef BOOST_STATIC_STRING_IS_CONST_EVAL
+  if (!BOOST_STATIC_STRING_IS_CONST_EVAL)
+    return rfind_not_char_runtime<Traits>(
+      first, last, c, is_fast_traits<Traits>{});
+#endif
+  for (auto it = last; it != first;)
+    if (!Traits::eq(*--it, c))
+      return it;
+  return last;
+}
 
-  /// The reference type.
-  using reference = value_type&;
+// Ignore -Wmaybe-uninitialized, GCC cannot tell that the
+// wide loads below are not reached for small strings, whose
+// size is never large enough to take those paths.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
 
-  /// The constant pointer type.
-  using const_pointer = const value_type*;
+// Unaligned load of a T from p
+template<typename T>
+inline
+T
+load_unaligned(const unsigned char* p) noexcept
+{
+  T x;
+  std::memcpy(&x, p, sizeof(x));
+  return x;
+}
 
-  /// The constant reference type.
-  using const_reference = const value_type&;
-
-  /// The iterator type.
-  using iterator = value_type*;
-
-  /// The constant iterator type.
-  using const_iterator = const value_type*;
-
-  /// The reverse iterator type.
-  using reverse_iterator =
-    std::reverse_iterator<iterator>;
-
-  /// The constant reverse iterator type.
-  using const_reverse_iterator =
-    std::reverse_iterator<const_iterator>;
+// Whether {a, a + n) and {b, b + n) hold the same bytes. Blocks of
+// 8, 16 or 32 bytes are compared at once, and the last block is
+// allowed to overlap the one before it instead of looping over the
+// remainder. Short inputs do not pay for a call to memcmp.
+inline
+bool
+equal_bytes(
+  const unsigned char* a,
+  const unsigned char* b,
+  std::size_t n) noexcept
+{
+  if (n < 8)
+  {
+    if (n >= 4)
+      return load_unaligned<std::uint32_t>(a) ==
+        load_unaligned<std::uint32_t>(b) &&
+        load_unaligned<std::uint32_t>(a + n - 4) ==
+        load_unaligned<std::uint32_t>(b + n - 4);
+    if (n >= 2)
+      return load_unaligned<std::uint16_t>(a) ==
+        load_unaligned<std::uint16_t>(b) &&
+        load_unaligned<std::uint16_t>(a + n - 2) ==
+        load_unaligned<std::uint16_t>(b + n - 2);
+    return !n || *a == *b;
+  }
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+  if (n >= 32)
+  {
+    const auto ne = [](const unsigned char* x, const unsigned char* y)
+    {
+      return _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y)))) != -1;
+    };
+    for (std::size_t i = 0; i + 32 < n; i += 32)
+      if (ne(a + i, b + i))
+        return false;
+    return !ne(a + n - 32, b + n - 32);
+  }
+#endif
+#ifdef BOOST_STATIC_STRING_HAS_SSE2
+  if (n >= 16)
+  {
+    const auto ne = [](const unsigned char* x, const unsigned char* y)
+    {
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(x)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(y)))) != 0xffff;
+    };
+    for (std::size_t i = 0; i + 16 < n; i += 16)
+      if (ne(a + i, b + i))
+        return false;
+    return !ne(a + n - 16, b + n - 16);
+  }
+#endif
+  for (std::size_t i = 0; i + 8 < n; i += 8)
+    if (load_unaligned<std::uint64_t>(a + i) !=
+        load_unaligned<std::uint64_t>(b + i))
+      return false;
+  return load_unaligned<std::uint64_t>(a + n - 8) ==
+    load_unaligned<std::uint64_t>(b + n - 8);
+}
 
-#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
-  /// The string view type.
-  using string_view_type =
-    basic_string_view<value_type, traits_type>;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
 #endif
 
-  //--------------------------------------------------------------------------
-  //
-  // Constants
-  //
-  //--------------------------------------------------------------------------
+template<typename Traits, typename CharT>
+inline
+bool
+equal_runtime(
+  const CharT* s1,
+  const CharT* s2,
+  std::size_t n,
+  std::false_type) noexcept
+{
+  return !Traits::compare(s1, s2, n);
+}
 
-  /// Maximum size of the string excluding any null terminator
-  static constexpr size_type static_capacity = N;
+template<typename Traits, typename CharT>
+inline
+bool
+equal_runtime(
+  const CharT* s1,
+  const CharT* s2,
+  std::size_t n,
+  std::true_type) noexcept
+{
+  return equal_bytes(
+    reinterpret_cast<const unsigned char*>(s1),
+    reinterpret_cast<const unsigned char*>(s2),
+    n * sizeof(CharT));
+}
 
-  /// A special index
-  static constexpr size_type npos = size_type(-1);
+// Whether two strings are equal. Strings of different
+// sizes are rejected without looking at their characters.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+equal(
+  const CharT* s1,
+  std::size_t n1,
+  const CharT* s2,
+  std::size_t n2) noexcept
+{
+  if (n1 != n2)
+    return false;
+#ifdef BOOST_STATIC_STRING_IS_CONST_EVAL
+  if (!BOOST_STATIC_STRING_IS_CONST_EVAL)
+    return equal_runtime<Traits>(s1, s2, n1, is_fast_traits<Traits>{});
+#endif
+  return !Traits::compare(s1, s2, n1);
+}
 
-  //--------------------------------------------------------------------------
-  //
-  // Construction
-  //
-  //--------------------------------------------------------------------------
+// Full 64x64 bit product, the low half is
+// stored in a and the high half in b.
+inline
+void
+mul128(
+  std::uint64_t& a,
+  std::uint64_t& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128;
+  const uint128 r = uint128(a) * b;
+  a = static_cast<std::uint64_t>(r);
+  b = static_cast<std::uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  a = _umul128(a, b, &b);
+#else
+  const std::uint64_t ha = a >> 32;
+  const std::uint64_t hb = b >> 32;
+  const std::uint64_t la = static_cast<std::uint32_t>(a);
+  const std::uint64_t lb = static_cast<std::uint32_t>(b);
+  const std::uint64_t rh = ha * hb;
+  const std::uint64_t rm0 = ha * lb;
+  const std::uint64_t rm1 = hb * la;
+  const std::uint64_t rl = la * lb;
+  const std::uint64_t t = rl + (rm0 << 32);
+  std::uint64_t c = t < rl;
+  const std::uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
 
-  /** Constructor.
+#if BOOST_STATIC_STRING_ARCH == 64
+inline
+std::uint64_t
+mix64(
+  std::uint64_t a,
+  std::uint64_t b) noexcept
+{
+  mul128(a, b);
+  return a ^ b;
+}
 
-      Construct an empty string
-  */
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  basic_static_string() noexcept
+// wyhash (Wang Yi, public domain), consumes 48 bytes per step
+// for long inputs and 16 bytes per step otherwise.
+inline
+std::size_t
+hash_bytes(
+  const unsigned char* p,
+  std::size_t len,
+  std::size_t seed = 0) noexcept
+{
+  const std::uint64_t secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+    0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+  const auto r8 = [](const unsigned char* q)
+  {
+    return load_unaligned<std::uint64_t>(q);
+  };
+  const auto r4 = [](const unsigned char* q) -> std::uint64_t
+  {
+    return load_unaligned<std::uint32_t>(q);
+  };
+  std::uint64_t h = mix64(seed ^ secret[0], secret[1]);
+  std::uint64_t a;
+  std::uint64_t b;
+  if (len <= 16)
+  {
+    if (len >= 4)
+    {
+      const std::size_t off = (len >> 3) << 2;
+      a = (r4(p) << 32) | r4(p + off);
+      b = (r4(p + len - 4) << 32) | r4(p + len - 4 - off);
+    }
+    else if (len > 0)
+    {
+      a = (std::uint64_t(p[0]) << 16) |
+        (std::uint64_t(p[len >> 1]) << 8) | p[len - 1];
+      b = 0;
+    }
+    else
+      a = b = 0;
+  }
+  else
   {
-#ifdef BOOST_STATIC_STRING_CPP20
-    term();
+    std::size_t i = len;
+    if (i > 48)
+    {
+      std::uint64_t h1 = h;
+      std::uint64_t h2 = h;
+      do
+      {
+        h = mix64(r8(p) ^ secret[1], r8(p + 8) ^ h);
+        h1 = mix64(r8(p + 16) ^ secret[2], r8(p + 24) ^ h1);
+        h2 = mix64(r8(p + 32) ^ secret[3], r8(p + 40) ^ h2);
+        p += 48;
+        i -= 48;
+      }
+      while (i > 48);
+      h ^= h1 ^ h2;
+    }
+    for (; i > 16; i -= 16, p += 16)
+      h = mix64(r8(p) ^ secret[1], r8(p + 8) ^ h);
+    a = r8(p + i - 16);
+    b = r8(p + i - 8);
+  }
+  a ^= secret[1];
+  b ^= h;
+  mul128(a, b);
+  return static_cast<std::size_t>(
+    mix64(a ^ secret[0] ^ len, b ^ secret[1]));
+}
+#elif BOOST_STATIC_STRING_ARCH == 32
+inline
+void
+mix32(
+  std::uint32_t& a,
+  std::uint32_t& b) noexcept
+{
+  const std::uint64_t c = std::uint64_t(a ^ 0x53c5ca59u) * (b ^ 0x74743c1bu);
+  a = static_cast<std::uint32_t>(c);
+  b = static_cast<std::uint32_t>(c >> 32);
+}
+
+// wyhash32 (Wang Yi, public domain), consumes 8 bytes per step
+// using only 32x32 bit multiplications.
+inline
+std::size_t
+hash_bytes(
+  const unsigned char* p,
+  std::size_t len,
+  std::size_t seed = 0) noexcept
+{
+  const auto r4 = [](const unsigned char* q)
+  {
+    return load_unaligned<std::uint32_t>(q);
+  };
+  std::uint32_t h = static_cast<std::uint32_t>(seed);
+  std::uint32_t h1 = static_cast<std::uint32_t>(len);
+  mix32(h, h1);
+  std::size_t i = len;
+  for (; i > 8; i -= 8, p += 8)
+  {
+    h ^= r4(p);
+    h1 ^= r4(p + 4);
+    mix32(h, h1);
+  }
+  if (i >= 4)
+  {
+    h ^= r4(p);
+    h1 ^= r4(p + i - 4);
+  }
+  else if (i)
+    h ^= (std::uint32_t(p[0]) << 16) |
+      (std::uint32_t(p[i >> 1]) << 8) | p[i - 1];
+  mix32(h, h1);
+  mix32(h, h1);
+  return h ^ h1;
+}
 #endif
-  }
 
-  /** Constructor.
+// Hash of the string {s, s + n). This is the hash std::hash
+// produces for a basic_static_string with the same contents.
+template<typename CharT, typename Traits>
+inline
+std::size_t
+hash_chars(
+  const CharT* s,
+  std::size_t n) noexcept
+{
+#if !defined(BOOST_STATIC_STRING_STANDALONE)
+  return boost::hash_range(s, s + n);
+#elif defined(BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW)
+  return std::hash<basic_string_view<CharT, Traits>>()(
+    basic_string_view<CharT, Traits>(s, n));
+#else
+  return hash_bytes(
+    reinterpret_cast<const unsigned char*>(s), n * sizeof(CharT));
+#endif
+}
 
-      Construct the string with `count` copies of character `ch`.
+// A 128 bit unsigned integer
+struct uint128
+{
+  std::uint64_t lo;
+  std::uint64_t hi;
+};
 
-      The behavior is undefined if `count >= npos`
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    size_type count,
-    value_type ch)
-  {
-    assign(count, ch);
-  }
+inline
+uint128
+mul_64x64(
+  std::uint64_t a,
+  std::uint64_t b) noexcept
+{
+  mul128(a, b);
+  return {a, b};
+}
 
-  /** Constructor.
+// The sign, biased exponent and fraction
+// of an IEEE 754 binary floating point value
+struct float_parts
+{
+  std::uint64_t mantissa;
+  std::uint32_t exponent;
+  bool negative;
+  int mantissa_bits;
+  int bias;
 
-      Construct with a substring (pos, other.size()) of `other`.
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    const basic_static_string<M, CharT, Traits>& other,
-    size_type pos)
+  bool
+  is_special() const noexcept
   {
-    assign(other, pos);
+    return exponent == std::uint32_t(2 * bias + 1);
   }
 
-  /** Constructor.
-
-      Construct with a substring (pos, count) of `other`.
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    const basic_static_string<M, CharT, Traits>& other,
-    size_type pos,
-    size_type count)
+  bool
+  is_zero() const noexcept
   {
-    assign(other, pos, count);
+    return !mantissa && !exponent;
   }
 
-  /** Constructor.
-
-      Construct with the first `count` characters of `s`, including nulls.
-    */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    const_pointer s,
-    size_type count)
+  // The value is m2 * 2^e2
+  std::uint64_t
+  m2() const noexcept
   {
-    assign(s, count);
+    return exponent ?
+      mantissa | (std::uint64_t(1) << mantissa_bits) : mantissa;
   }
 
-  /** Constructor.
-
-      Construct from a null terminated string.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(const_pointer s)
+  int
+  e2() const noexcept
   {
-    assign(s);
+    return (exponent ? int(exponent) : 1) - bias - mantissa_bits;
   }
+};
 
-  /** Constructor.
+inline
+float_parts
+decompose(double value) noexcept
+{
+  static_assert(std::numeric_limits<double>::is_iec559 &&
+    std::numeric_limits<double>::digits == 53,
+    "double must be an IEEE 754 binary64");
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return {bits & ((std::uint64_t(1) << 52) - 1),
+    static_cast<std::uint32_t>((bits >> 52) & 0x7ff),
+    (bits >> 63) != 0, 52, 1023};
+}
 
-      Construct from a range of characters
-  */
-  template<typename InputIterator
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename std::enable_if<
-      detail::is_input_iterator<InputIterator>
-        ::value>::type* = nullptr
-#endif
-  >
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    InputIterator first,
-    InputIterator last)
-  {
-    // KRYSTIAN TODO: we can use a better algorithm if this is a forward iterator
-    assign(first, last);
-  }
+inline
+float_parts
+decompose(float value) noexcept
+{
+  static_assert(std::numeric_limits<float>::is_iec559 &&
+    std::numeric_limits<float>::digits == 24,
+    "float must be an IEEE 754 binary32");
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return {bits & ((std::uint32_t(1) << 23) - 1),
+    (bits >> 23) & 0xff, (bits >> 31) != 0, 23, 127};
+}
 
-  /** Constructor.
+// The number of bits of 5^e, for 0 <= e <= 3528
+inline
+int
+pow5_bits(int e) noexcept
+{
+  return static_cast<int>(
+    (static_cast<std::uint32_t>(e) * 1217359) >> 19) + 1;
+}
 
-      Copy constructor.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(const basic_static_string& other) noexcept
-  {
-    assign(other);
-  }
+// floor(log10(2^e)), for 0 <= e <= 1650
+inline
+int
+log10_pow2(int e) noexcept
+{
+  return static_cast<int>(
+    (static_cast<std::uint32_t>(e) * 78913) >> 18);
+}
 
-  /** Constructor.
+// floor(log10(5^e)), for 0 <= e <= 2620
+inline
+int
+log10_pow5(int e) noexcept
+{
+  return static_cast<int>(
+    (static_cast<std::uint32_t>(e) * 732923) >> 20);
+}
 
-      Copy constructor.
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    const basic_static_string<M, CharT, Traits>& other)
-  {
-    assign(other);
-  }
+// 5^e, for 0 <= e <= 25
+inline
+std::uint64_t
+pow5(int e) noexcept
+{
+  static constexpr std::uint64_t table[26] = {
+    1ull, 5ull, 25ull, 125ull, 625ull, 3125ull, 15625ull, 78125ull,
+    390625ull, 1953125ull, 9765625ull, 48828125ull, 244140625ull,
+    1220703125ull, 6103515625ull, 30517578125ull, 152587890625ull,
+    762939453125ull, 3814697265625ull, 19073486328125ull,
+    95367431640625ull, 476837158203125ull, 2384185791015625ull,
+    11920928955078125ull, 59604644775390625ull, 298023223876953125ull};
+  return table[e];
+}
 
-  /** Constructor.
+// The 192 bit product m * {lo, hi}, shifted right
+// by 0 < n < 64 and truncated to 128 bits
+inline
+uint128
+mul_shift_192(
+  std::uint64_t m,
+  std::uint64_t lo,
+  std::uint64_t hi,
+  int n) noexcept
+{
+  const uint128 b0 = mul_64x64(m, lo);
+  const uint128 b2 = mul_64x64(m, hi);
+  const std::uint64_t mid = b0.hi + b2.lo;
+  const std::uint64_t top = b2.hi + (mid < b0.hi);
+  return {(b0.lo >> n) | (mid << (64 - n)),
+    (mid >> n) | (top << (64 - n))};
+}
 
-      Construct from an initializer list
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(std::initializer_list<value_type> init)
-  {
-    assign(init.begin(), init.size());
-  }
+// The 125 most significant bits of 5^i, for 0 <= i < 338.
+// Every 26th power is stored, the others are derived from
+// it and corrected with the 2 bit offsets, as done by the
+// small table variant of Ryu.
+inline
+uint128
+pow5_split(int i) noexcept
+{
+  static constexpr std::uint64_t split[13][2] = {
+    {0x0000000000000000ull, 0x1000000000000000ull},
+    {0x0000000000000000ull, 0x14adf4b7320334b9ull},
+    {0x0e549208b31adb10ull, 0x1aba4714957d300dull},
+    {0x6dc6ad264d8f0866ull, 0x1145b7e285bf98f5ull},
+    {0xeb1dbd923d8596caull, 0x1652efdc6018a1fcull},
+    {0xb4c1b80b22ae923cull, 0x1cda62055b2d9d83ull},
+    {0x5bb28b4e8f7e4c30ull, 0x12a5568b9f52f416ull},
+    {0xf08aed437682d4fbull, 0x1819651531f9e78full},
+    {0xb4ee134ad99bf150ull, 0x1f25c186a6f04c28ull},
+    {0x16499ecb70c25f03ull, 0x1420eb449c8842e6ull},
+    {0x85a56ead360865b0ull, 0x1a03fde214caf085ull},
+    {0x093db1d57999890bull, 0x10cfeb353a97dad8ull},
+    {0xcf38bb735e3f36acull, 0x15baaf44fa52673eull}};
+  static constexpr std::uint32_t offsets[21] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000,
+    0x59695995, 0x55545555, 0x56555515, 0x41150504, 0x40555410,
+    0x44555145, 0x44504540, 0x45555550, 0x40004000, 0x96440440,
+    0x55565565, 0x54454045, 0x40154151, 0x55559155, 0x51405555,
+    0x00000105};
+  const int base = i / 26;
+  const int offset = i - base * 26;
+  const std::uint64_t* mul = split[base];
+  if (!offset)
+    return {mul[0], mul[1]};
+  uint128 r = mul_shift_192(pow5(offset), mul[0], mul[1],
+    pow5_bits(i) - pow5_bits(base * 26));
+  const std::uint64_t fix = (offsets[i / 16] >> ((i % 16) * 2)) & 3;
+  r.lo += fix;
+  r.hi += r.lo < fix;
+  return r;
+}
 
-  /** Constructor.
+// floor(2^(pow5_bits(i) + 124) / 5^i) + 1, for 0 <= i < 364,
+// stored like pow5_split.
+inline
+uint128
+pow5_inv_split(int i) noexcept
+{
+  static constexpr std::uint64_t split[15][2] = {
+    {0x0000000000000001ull, 0x2000000000000000ull},
+    {0x52a6c95fc0655034ull, 0x18c240c4aecb13bbull},
+    {0x7ca8d50071dfc806ull, 0x1327fc58da0f6ff5ull},
+    {0x6520247d3556476eull, 0x1da48ce468e7c702ull},
+    {0x6139cdd76802e6e9ull, 0x16ef5b40c2fc7779ull},
+    {0xf951a7ff43de8c79ull, 0x11bebdf578b2f391ull},
+    {0x7be8bee8d6e957e8ull, 0x1b758d848fac54b0ull},
+    {0x8bd3f9e999a423eaull, 0x153eda614071a3b7ull},
+    {0x0848f973cb3ee3ceull, 0x10701bd527b4978cull},
+    {0x153285ebb9efbfa2ull, 0x196fbb9bb44db44dull},
+    {0xadeee7f86c07b696ull, 0x13ae3591f5b4d936ull},
+    {0x4d686a4eaf182222ull, 0x1e74404f3daada91ull},
+    {0x98c0a106e09ebd9full, 0x17900ea4fda7c257ull},
+    {0x8f20e37371497d0eull, 0x123b140576d820b2ull},
+    {0xb043138134743d85ull, 0x1c35f4275f7a29adull}};
+  static constexpr std::uint32_t offsets[22] = {
+    0x54544554, 0x04055545, 0x10041000, 0x00400414, 0x40010000,
+    0x41155555, 0x00000454, 0x00010044, 0x40000000, 0x44000041,
+    0x50454450, 0x55550054, 0x51655554, 0x40004000, 0x01000001,
+    0x00010500, 0x51515411, 0x05555554, 0x50411500, 0x40040000,
+    0x05040110, 0x00000000};
+  const int base = (i + 25) / 26;
+  const int offset = base * 26 - i;
+  const std::uint64_t* mul = split[base];
+  if (!offset)
+    return {mul[0], mul[1]};
+  // every low half is odd, so subtracting one cannot borrow
+  uint128 r = mul_shift_192(pow5(offset), mul[0] - 1, mul[1],
+    pow5_bits(base * 26) - pow5_bits(i));
+  const std::uint64_t fix =
+    ((offsets[i / 16] >> ((i % 16) * 2)) & 3) + 1;
+  r.lo += fix;
+  r.hi += r.lo < fix;
+  return r;
+}
 
-      Construct from a object convertible to `string_view_type`
-  */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
-  explicit
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(const T& t)
+// (m * mul) >> j, for 64 < j < 128
+inline
+std::uint64_t
+mul_shift_64(
+  std::uint64_t m,
+  const uint128& mul,
+  int j) noexcept
+{
+  const uint128 b0 = mul_64x64(m, mul.lo);
+  const uint128 b2 = mul_64x64(m, mul.hi);
+  const std::uint64_t lo = b0.hi + b2.lo;
+  const std::uint64_t hi = b2.hi + (lo < b0.hi);
+  j -= 64;
+  return (lo >> j) | (hi << (64 - j));
+}
+
+inline
+bool
+multiple_of_pow5(
+  std::uint64_t value,
+  int p) noexcept
+{
+  int count = 0;
+  for (; value % 5 == 0; value /= 5)
+    ++count;
+  return count >= p;
+}
+
+// A decimal floating point number, digits * 10^exponent
+struct decimal_fp
+{
+  std::uint64_t digits;
+  int exponent;
+};
+
+// The shortest decimal that rounds to the finite, nonzero
+// value f, picking the closest one when there are several.
+// This is Ryu (Ulf Adams, "Ryu: fast float-to-string
+// conversion", PLDI 2018), which is also used for float
+// since its mantissa fits in the computations for double.
+inline
+decimal_fp
+shortest_decimal(const float_parts& f) noexcept
+{
+  const std::uint64_t m2 = f.m2();
+  const int e2 = f.e2() - 2;
+  const bool accept_bounds = !(m2 & 1);
+  // the interval of values rounding to f is {4 * m2 - 1 - mm_shift,
+  // 4 * m2 + 2} * 2^e2, it is asymmetric at powers of two
+  const std::uint64_t mv = 4 * m2;
+  const std::uint32_t mm_shift = f.mantissa != 0 || f.exponent <= 1;
+  std::uint64_t vr;
+  std::uint64_t vp;
+  std::uint64_t vm;
+  int e10;
+  bool vm_trailing_zeros = false;
+  bool vr_trailing_zeros = false;
+  if (e2 >= 0)
+  {
+    const int q = log10_pow2(e2) - (e2 > 3);
+    e10 = q;
+    const int k = 125 + pow5_bits(q) - 1;
+    const int i = -e2 + q + k;
+    const uint128 mul = pow5_inv_split(q);
+    vr = mul_shift_64(4 * m2, mul, i);
+    vp = mul_shift_64(4 * m2 + 2, mul, i);
+    vm = mul_shift_64(4 * m2 - 1 - mm_shift, mul, i);
+    if (q <= 21)
+    {
+      // only one of mp, mv and mm can be a multiple of 5
+      if (mv % 5 == 0)
+        vr_trailing_zeros = multiple_of_pow5(mv, q);
+      else if (accept_bounds)
+        vm_trailing_zeros = multiple_of_pow5(mv - 1 - mm_shift, q);
+      else
+        vp -= multiple_of_pow5(mv + 2, q);
+    }
+  }
+  else
   {
-    assign(t);
+    const int q = log10_pow5(-e2) - (-e2 > 1);
+    e10 = q + e2;
+    const int i = -e2 - q;
+    const int k = pow5_bits(i) - 125;
+    const int j = q - k;
+    const uint128 mul = pow5_split(i);
+    vr = mul_shift_64(4 * m2, mul, j);
+    vp = mul_shift_64(4 * m2 + 2, mul, j);
+    vm = mul_shift_64(4 * m2 - 1 - mm_shift, mul, j);
+    if (q <= 1)
+    {
+      // mv = 4 * m2 always has at least two trailing zero bits
+      vr_trailing_zeros = true;
+      if (accept_bounds)
+        vm_trailing_zeros = mm_shift == 1;
+      else
+        --vp;
+    }
+    else if (q < 63)
+    {
+      vr_trailing_zeros =
+        (mv & ((std::uint64_t(1) << q) - 1)) == 0;
+    }
   }
+  // remove digits while the bounds still differ
+  int removed = 0;
+  std::uint64_t output;
+  if (vm_trailing_zeros || vr_trailing_zeros)
+  {
+    // the rare general case
+    unsigned last_removed = 0;
+    while (vp / 10 > vm / 10)
+    {
+      vm_trailing_zeros &= vm % 10 == 0;
+      vr_trailing_zeros &= last_removed == 0;
+      last_removed = static_cast<unsigned>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_trailing_zeros)
+    {
+      while (vm % 10 == 0)
+      {
+        vr_trailing_zeros &= last_removed == 0;
+        last_removed = static_cast<unsigned>(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    // round to even when the exact value is ...50...0
+    if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0)
+      last_removed = 4;
+    output = vr + ((vr == vm &&
+      (!accept_bounds || !vm_trailing_zeros)) || last_removed >= 5);
+  }
+  else
+  {
+    bool round_up = false;
+    if (vp / 100 > vm / 100)
+    {
+      round_up = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while (vp / 10 > vm / 10)
+    {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+  return {output, e10 + removed};
+}
 
-  /** Constructor.
-
-      Construct from any object convertible to `string_view_type`.
+// Stores the decimal digits of the nonzero value in digits,
+// without trailing zeros, and returns their number. The power
+// of ten of the first digit is stored in exponent.
+inline
+int
+to_digits(
+  decimal_fp d,
+  char* digits,
+  int& exponent) noexcept
+{
+  while (d.digits % 10 == 0)
+  {
+    d.digits /= 10;
+    ++d.exponent;
+  }
+  char buffer[20];
+  char* const end = buffer + 20;
+  const char* const first = unsigned_to_string(end, d.digits);
+  const int n = static_cast<int>(end - first);
+  std::memcpy(digits, first, n);
+  exponent = d.exponent + n - 1;
+  return n;
+}
 
-      The range (pos, n) is extracted from the value
-      obtained by converting `t` to `string_view_type`,
-      and used to construct the string.
-  */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string(
-    const T& t,
-    size_type pos,
-    size_type n)
+// Rounds the exact value of the finite, nonzero f to at most
+// 1 <= precision <= 30 significant digits, ties to even, like
+// printf does. The digits are stored as by to_digits.
+inline
+int
+round_digits(
+  const float_parts& f,
+  int precision,
+  char* digits,
+  int& exponent) noexcept
+{
+  // the value is m2 * 2^e2, which is an integer scaled by 10^e2 when
+  // e2 < 0. Its exact digits are generated in base 10^9 chunks.
+  const std::uint64_t m2 = f.m2();
+  const int e2 = f.e2();
+  std::uint32_t big[84];
+  int size = 0;
+  for (std::uint64_t m = m2; m; m >>= 32)
+    big[size++] = static_cast<std::uint32_t>(m);
+  if (e2 > 0)
+  {
+    const int words = e2 / 32;
+    const int bits = e2 % 32;
+    if (bits)
+    {
+      std::uint32_t carry = 0;
+      for (int i = 0; i < size; ++i)
+      {
+        const std::uint64_t v = std::uint64_t(big[i]) << bits;
+        big[i] = static_cast<std::uint32_t>(v) | carry;
+        carry = static_cast<std::uint32_t>(v >> 32);
+      }
+      if (carry)
+        big[size++] = carry;
+    }
+    for (int i = size; i-- > 0;)
+      big[i + words] = big[i];
+    for (int i = 0; i < words; ++i)
+      big[i] = 0;
+    size += words;
+  }
+  for (int k = -e2; k > 0; k -= 13)
   {
-    assign(t, pos, n);
+    const std::uint64_t mul = pow5(k < 13 ? k : 13);
+    std::uint64_t carry = 0;
+    for (int i = 0; i < size; ++i)
+    {
+      const std::uint64_t v = big[i] * mul + carry;
+      big[i] = static_cast<std::uint32_t>(v);
+      carry = v >> 32;
+    }
+    if (carry)
+      big[size++] = static_cast<std::uint32_t>(carry);
+  }
+  std::uint32_t chunks[90];
+  int count = 0;
+  while (size)
+  {
+    std::uint64_t rem = 0;
+    for (int i = size; i-- > 0;)
+    {
+      const std::uint64_t v = (rem << 32) | big[i];
+      big[i] = static_cast<std::uint32_t>(v / 1000000000);
+      rem = v % 1000000000;
+    }
+    chunks[count++] = static_cast<std::uint32_t>(rem);
+    while (size && !big[size - 1])
+      --size;
+  }
+  // the leading digits, at least precision + 1 of them,
+  // and whether any of the remaining ones is not zero
+  char lead[40];
+  char* const top_end = lead + 9;
+  char* const top = unsigned_to_string(top_end, chunks[count - 1]);
+  int n = static_cast<int>(top_end - top);
+  std::memmove(lead, top, n);
+  exponent = n - 1 + 9 * (count - 1) + (e2 < 0 ? e2 : 0);
+  int next = count - 1;
+  while (n <= precision && next > 0)
+  {
+    char* const end = lead + n + 9;
+    char* first = unsigned_to_string(end, chunks[--next]);
+    while (first != lead + n)
+      *--first = '0';
+    n += 9;
+  }
+  bool sticky = false;
+  while (next > 0)
+    sticky |= chunks[--next] != 0;
+  for (int i = precision + 1; i < n; ++i)
+    sticky |= lead[i] != '0';
+  if (n > precision)
+  {
+    const char d = lead[precision];
+    const bool up = d > '5' || (d == '5' &&
+      (sticky || (lead[precision - 1] - '0') % 2));
+    n = precision;
+    if (up)
+    {
+      while (n && lead[n - 1] == '9')
+        --n;
+      if (!n)
+      {
+        lead[0] = '1';
+        n = 1;
+        ++exponent;
+      }
+      else
+        ++lead[n - 1];
+    }
   }
+  while (lead[n - 1] == '0')
+    --n;
+  std::memcpy(digits, lead, n);
+  return n;
+}
 
-  //--------------------------------------------------------------------------
-  //
-  // Assignment
-  //
-  //--------------------------------------------------------------------------
+// The length of the digits in fixed notation,
+// without sign, as in 1234.5 or 0.0012345
+inline
+int
+fixed_length(
+  int n,
+  int exponent) noexcept
+{
+  return exponent >= n - 1 ? exponent + 1 :
+    exponent >= 0 ? n + 1 : n + 1 - exponent;
+}
 
-  /** Assign to the string.
+// The length of the digits in scientific
+// notation without sign, as in 1.2345e-03
+inline
+int
+scientific_length(
+  int n,
+  int exponent) noexcept
+{
+  return n + (n > 1) + (exponent >= 100 || exponent <= -100 ? 5 : 4);
+}
 
-      Replaces the contents with those of
-      the string `s`.
+template<typename CharT>
+inline
+CharT*
+write_fixed(
+  CharT* out,
+  const char* digits,
+  int n,
+  int exponent) noexcept
+{
+  if (exponent >= n - 1)
+  {
+    for (int i = 0; i < n; ++i)
+      *out++ = static_cast<CharT>(digits[i]);
+    for (int i = n - 1; i < exponent; ++i)
+      *out++ = static_cast<CharT>('0');
+  }
+  else if (exponent >= 0)
+  {
+    for (int i = 0; i <= exponent; ++i)
+      *out++ = static_cast<CharT>(digits[i]);
+    *out++ = static_cast<CharT>('.');
+    for (int i = exponent + 1; i < n; ++i)
+      *out++ = static_cast<CharT>(digits[i]);
+  }
+  else
+  {
+    *out++ = static_cast<CharT>('0');
+    *out++ = static_cast<CharT>('.');
+    for (int i = exponent + 1; i < 0; ++i)
+      *out++ = static_cast<CharT>('0');
+    for (int i = 0; i < n; ++i)
+      *out++ = static_cast<CharT>(digits[i]);
+  }
+  return out;
+}
 
-      @par Complexity
+template<typename CharT>
+inline
+CharT*
+write_scientific(
+  CharT* out,
+  const char* digits,
+  int n,
+  int exponent) noexcept
+{
+  *out++ = static_cast<CharT>(digits[0]);
+  if (n > 1)
+  {
+    *out++ = static_cast<CharT>('.');
+    for (int i = 1; i < n; ++i)
+      *out++ = static_cast<CharT>(digits[i]);
+  }
+  *out++ = static_cast<CharT>('e');
+  *out++ = static_cast<CharT>(exponent < 0 ? '-' : '+');
+  const unsigned e = exponent < 0 ? 0u - exponent : exponent;
+  if (e >= 100)
+    *out++ = static_cast<CharT>('0' + e / 100);
+  const char* const pair = digit_pairs() + (e % 100) * 2;
+  *out++ = static_cast<CharT>(pair[0]);
+  *out++ = static_cast<CharT>(pair[1]);
+  return out;
+}
 
-      Linear in `s.size()`.
+// Writes inf, nan or zero, returns nullptr for other values
+template<typename CharT>
+inline
+CharT*
+write_special(
+  CharT* out,
+  const float_parts& f) noexcept
+{
+  const bool special = f.is_special();
+  if (!special && !f.is_zero())
+    return nullptr;
+  if (f.negative)
+    *out++ = static_cast<CharT>('-');
+  const char* s = !special ? "0" : f.mantissa ? "nan" : "inf";
+  for (; *s; ++s)
+    *out++ = static_cast<CharT>(*s);
+  return out;
+}
 
-      @par Exception Safety
+// Writes the shortest string that reads back as value to out, using
+// fixed or scientific notation, whichever is shorter, like
+// std::to_chars. This is at most max_digits10 + 7 characters: a sign,
+// the digits, the decimal, the 'e', and an exponent of up to 4.
+template<typename CharT, typename Float>
+inline
+CharT*
+write_float(
+  CharT* out,
+  Float value) noexcept
+{
+  const float_parts f = decompose(value);
+  if (CharT* const end = write_special(out, f))
+    return end;
+  char digits[32];
+  int exponent;
+  int n = to_digits(shortest_decimal(f), digits, exponent);
+  if (f.negative)
+    *out++ = static_cast<CharT>('-');
+  if (fixed_length(n, exponent) <= scientific_length(n, exponent))
+  {
+    // like std::to_chars, integers are shown with
+    // their exact digits rather than trailing zeros
+    if (exponent >= n)
+      n = round_digits(f, exponent + 1, digits, exponent);
+    return write_fixed(out, digits, n, exponent);
+  }
+  return write_scientific(out, digits, n, exponent);
+}
 
-      Strong guarantee.
+// Writes value to out like printf's %.*g, without the trailing zeros
+// of the fraction. The precision is clamped to [1, max_digits10], so
+// at most max_digits10 + 7 characters are written.
+template<typename CharT, typename Float>
+inline
+CharT*
+write_float(
+  CharT* out,
+  Float value,
+  int precision) noexcept
+{
+  const float_parts f = decompose(value);
+  if (CharT* const end = write_special(out, f))
+    return end;
+  const int max = std::numeric_limits<Float>::max_digits10;
+  precision = precision < 1 ? 1 : precision > max ? max : precision;
+  char digits[20];
+  int exponent;
+  const int n = round_digits(f, precision, digits, exponent);
+  if (f.negative)
+    *out++ = static_cast<CharT>('-');
+  return exponent >= -4 && exponent < precision ?
+    write_fixed(out, digits, n, exponent) :
+    write_scientific(out, digits, n, exponent);
+}
 
-      @return `*this`
+template<std::size_t N, typename CharT, typename Float, typename... Args>
+inline
+basic_static_string<N, CharT, std::char_traits<CharT>>
+float_to_string(
+  Float value,
+  Args... args) noexcept
+{
+  static_assert(N >= std::size_t(
+    std::numeric_limits<Float>::max_digits10 + 7),
+    "the capacity must fit every value");
+  basic_static_string<N, CharT, std::char_traits<CharT>> result(
+    uninitialized);
+  string_access::set_size(result,
+    write_float(result.data(), value, args...) - result.data());
+  return result;
+}
 
-      @param s The string to replace
-      the contents with.
+// The value of the digit c in bases up to 36, or 36 if c is not a digit
+template<typename CharT>
+BOOST_STATIC_STRING_CPP11_CONSTEXPR
+inline
+unsigned
+digit_value(CharT c) noexcept
+{
+  return
+    c >= CharT('0') && c <= CharT('9') ? unsigned(c - CharT('0')) :
+    c >= CharT('a') && c <= CharT('z') ? unsigned(c - CharT('a')) + 10 :
+    c >= CharT('A') && c <= CharT('Z') ? unsigned(c - CharT('A')) + 10 : 36;
+}
 
-      @throw std::length_error `s.size() > max_size()`.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator=(const basic_static_string& s)
+// Accumulates the digits in base starting at s[i] into value, which
+// may not exceed limit. Returns the position after the last digit.
+template<typename Unsigned, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+std::size_t
+accumulate_digits(
+  const CharT* s,
+  std::size_t i,
+  std::size_t n,
+  unsigned base,
+  Unsigned limit,
+  Unsigned& value,
+  bool& overflow) noexcept
+{
+  for (; i < n; ++i)
   {
-    return assign(s);
+    const unsigned d = digit_value(s[i]);
+    if (d >= base)
+      break;
+    if (value > Unsigned(limit - d) / base)
+      overflow = true;
+    else
+      value = Unsigned(value * base + d);
   }
+  return i;
+}
 
-  /** Assign to the string.
+// Whether the 8 characters in v, first character
+// in the low byte, are all decimal digits
+inline
+bool
+is_eight_digits(std::uint64_t v) noexcept
+{
+  return (((v & 0xf0f0f0f0f0f0f0f0ull) |
+    (((v + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) ==
+    0x3333333333333333ull);
+}
 
-      Replaces the contents with those of
-      the string `s`.
+// The value of the 8 decimal digits in v, combined
+// in pairs, then quadruples, then octets
+inline
+std::uint32_t
+parse_eight_digits(std::uint64_t v) noexcept
+{
+  v -= 0x3030303030303030ull;
+  v = (v * 10) + (v >> 8);
+  v = (((v & 0x000000ff000000ffull) * 0x000f424000000064ull) +
+    (((v >> 16) & 0x000000ff000000ffull) * 0x0000271000000001ull)) >> 32;
+  return static_cast<std::uint32_t>(v);
+}
 
-      @par Complexity
+inline
+std::uint64_t
+load_digits(const char* s) noexcept
+{
+  std::uint64_t v = 0;
+  for (int i = 0; i < 8; ++i)
+    v |= std::uint64_t(static_cast<unsigned char>(s[i])) << (8 * i);
+  return v;
+}
 
-      Linear in `s.size()`.
+template<typename Unsigned, typename CharT>
+inline
+std::size_t
+accumulate_decimal_runtime(
+  const CharT*,
+  std::size_t i,
+  std::size_t,
+  Unsigned,
+  Unsigned&,
+  bool&,
+  std::false_type) noexcept
+{
+  return i;
+}
 
-      @par Exception Safety
+// Consumes leading decimal digits 8 at a time, while
+// they cannot overflow 64 bits, and returns the position
+// after them. The remaining digits are left to the caller.
+template<typename Unsigned>
+inline
+std::size_t
+accumulate_decimal_runtime(
+  const char* s,
+  std::size_t i,
+  std::size_t n,
+  Unsigned limit,
+  Unsigned& value,
+  bool& overflow,
+  std::true_type) noexcept
+{
+  std::uint64_t acc = 0;
+  const std::size_t start = i;
+  for (; n - i >= 8 && acc <= 184467440736ull; i += 8)
+  {
+    const std::uint64_t v = load_digits(s + i);
+    if (!is_eight_digits(v))
+      break;
+    acc = acc * 100000000 + parse_eight_digits(v);
+  }
+  if (i != start)
+  {
+    if (acc > limit)
+      overflow = true;
+    else
+      value = static_cast<Unsigned>(acc);
+  }
+  return i;
+}
 
-      Strong guarantee.
+// Parses an integer like std::from_chars: an optional minus sign
+// for signed types, followed by the digits in base. Stores the
+// number of characters of the match in size.
+template<typename T, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+std::errc
+parse_integer(
+  const CharT* s,
+  std::size_t n,
+  int base,
+  T& result,
+  std::size_t& size) noexcept
+{
+  using unsigned_type = typename std::make_unsigned<T>::type;
+  result = T();
+  size = 0;
+  if (base < 2 || base > 36)
+    return std::errc::invalid_argument;
+  const bool negative =
+    std::is_signed<T>::value && n && s[0] == CharT('-');
+  const std::size_t start = negative;
+  const unsigned_type limit = negative ?
+    unsigned_type(unsigned_type((std::numeric_limits<T>::max)()) + 1) :
+    unsigned_type((std::numeric_limits<T>::max)());
+  unsigned_type value = 0;
+  bool overflow = false;
+  std::size_t i = start;
+#ifdef BOOST_STATIC_STRING_IS_CONST_EVAL
+  if (!BOOST_STATIC_STRING_IS_CONST_EVAL && base == 10)
+    i = accumulate_decimal_runtime(s, i, n, limit, value, overflow,
+      std::integral_constant<bool, std::is_same<CharT, char>::value &&
+        sizeof(unsigned_type) <= sizeof(std::uint64_t)>{});
+#endif
+  i = accumulate_digits(s, i, n, unsigned(base), limit, value, overflow);
+  if (i == start)
+    return std::errc::invalid_argument;
+  size = i;
+  if (overflow)
+    return std::errc::result_out_of_range;
+  // negating through value - 1 keeps the minimum in range
+  result = !negative || !value ? T(value) :
+    T(-T(unsigned_type(value - 1)) - 1);
+  return std::errc();
+}
 
-      @tparam M The size of the other string.
+// Whether {s + i, s + n) starts with the lowercase word,
+// ignoring case
+template<typename CharT>
+inline
+bool
+starts_with_word(
+  const CharT* s,
+  std::size_t i,
+  std::size_t n,
+  const char* word) noexcept
+{
+  for (; *word; ++word, ++i)
+    if (i == n || (s[i] != CharT(*word) &&
+        s[i] != CharT(*word - 'a' + 'A')))
+      return false;
+  return true;
+}
 
-      @return `*this`
+template<typename Float>
+inline
+Float
+string_to_float(const char* s) noexcept
+{
+  return static_cast<Float>(std::strtod(s, nullptr));
+}
 
-      @param s The string to replace
-      the contents with.
+template<>
+inline
+float
+string_to_float<float>(const char* s) noexcept
+{
+  return std::strtof(s, nullptr);
+}
 
-      @throw std::length_error `s.size() > max_size()`.
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator=(const basic_static_string<M, CharT, Traits>& s)
+template<>
+inline
+long double
+string_to_float<long double>(const char* s) noexcept
+{
+  return std::strtold(s, nullptr);
+}
+
+// Parses a floating point number like std::from_chars in the general
+// format: an optional minus sign, then inf, infinity, nan, nan(chars)
+// or digits with an optional decimal point and exponent. Stores the
+// number of characters of the match in size.
+template<typename Float, typename CharT>
+inline
+std::errc
+parse_float(
+  const CharT* s,
+  std::size_t n,
+  Float& result,
+  std::size_t& size) noexcept
+{
+  result = Float();
+  size = 0;
+  const bool negative = n && s[0] == CharT('-');
+  std::size_t i = negative;
+  if (starts_with_word(s, i, n, "inf"))
+  {
+    i += starts_with_word(s, i, n, "infinity") ? 8 : 3;
+    size = i;
+    result = negative ? -std::numeric_limits<Float>::infinity() :
+      std::numeric_limits<Float>::infinity();
+    return std::errc();
+  }
+  if (starts_with_word(s, i, n, "nan"))
+  {
+    i += 3;
+    if (i < n && s[i] == CharT('('))
+    {
+      std::size_t j = i + 1;
+      while (j < n && (digit_value(s[j]) < 36 || s[j] == CharT('_')))
+        ++j;
+      if (j < n && s[j] == CharT(')'))
+        i = j + 1;
+    }
+    size = i;
+    result = negative ? -std::numeric_limits<Float>::quiet_NaN() :
+      std::numeric_limits<Float>::quiet_NaN();
+    return std::errc();
+  }
+  // The significant digits are copied without the decimal point,
+  // so the result does not depend on the locale. 800 digits are
+  // enough to round a double correctly, the digits past them only
+  // matter through whether one of them is not zero.
+  const int max_digits = 800;
+  char buffer[max_digits + 16];
+  int count = 0;
+  bool truncated = false;
+  long exponent = 0;
+  std::uint64_t mantissa = 0;
+  bool any = false;
+  bool point = false;
+  for (; i < n; ++i)
+  {
+    if (s[i] == CharT('.') && !point)
+    {
+      point = true;
+      continue;
+    }
+    const unsigned d = digit_value(s[i]);
+    if (d >= 10)
+      break;
+    any = true;
+    if (!count && !d)
+    {
+      exponent -= point;
+      continue;
+    }
+    if (count < max_digits)
+    {
+      buffer[count++] = static_cast<char>('0' + d);
+      mantissa = mantissa * 10 + d;
+      exponent -= point;
+    }
+    else
+    {
+      truncated |= d != 0;
+      exponent += !point;
+    }
+  }
+  if (!any)
+    return std::errc::invalid_argument;
+  // the exponent is only part of the match when it has digits
+  if (i < n && (s[i] == CharT('e') || s[i] == CharT('E')))
   {
-    return assign(s);
+    std::size_t j = i + 1;
+    const bool exp_negative = j < n && s[j] == CharT('-');
+    j += j < n && (s[j] == CharT('-') || s[j] == CharT('+'));
+    if (j < n && digit_value(s[j]) < 10)
+    {
+      long e = 0;
+      for (; j < n && digit_value(s[j]) < 10; ++j)
+        if (e < 100000)
+          e = e * 10 + long(digit_value(s[j]));
+      exponent += exp_negative ? -e : e;
+      i = j;
+    }
+  }
+  size = i;
+  if (!count)
+  {
+    result = negative ? -Float(0) : Float(0);
+    return std::errc();
   }
+  Float value;
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  // exact operands give a correctly rounded result (Clinger)
+  const int digits = std::numeric_limits<Float>::digits;
+  const long max_exact = digits > 24 ? 22 : 10;
+  if (count <= 19 && digits <= 53 &&
+      mantissa <= (std::uint64_t(1) << digits) &&
+      exponent >= -max_exact && exponent <= max_exact)
+  {
+    Float scale = 1;
+    for (long k = exponent < 0 ? -exponent : exponent; k; --k)
+      scale *= 10;
+    value = exponent < 0 ?
+      Float(mantissa) / scale : Float(mantissa) * scale;
+  }
+  else
+#endif
+  {
+    if (truncated)
+    {
+      buffer[count++] = '1';
+      --exponent;
+    }
+    char* out = buffer + count;
+    *out++ = 'e';
+    if (exponent < 0)
+      *out++ = '-';
+    const unsigned long e = exponent < 0 ? 0ul - exponent : exponent;
+    char* const end = out + 8;
+    char* const first = unsigned_to_string(end, e);
+    std::memmove(out, first, end - first);
+    out[end - first] = '\0';
+    value = string_to_float<Float>(buffer);
+    if (value == std::numeric_limits<Float>::infinity() || value == 0)
+      return std::errc::result_out_of_range;
+  }
+  result = negative ? -value : value;
+  return std::errc();
+}
 
-  /** Assign to the string.
+// Whether T is accepted by the transparent function objects,
+// either a string-like type or a null-terminated string.
+template<typename T, typename CharT>
+struct is_char_range
+  : std::integral_constant<bool,
+      is_string_like<T, CharT>::value ||
+      std::is_convertible<const T&, const CharT*>::value> { };
 
-      Replaces the contents with those of
-      `{s, s + traits_type::length(s))`.
+template<typename CharT>
+struct char_range
+{
+  const CharT* data;
+  std::size_t size;
+};
 
-      @par Complexity
+template<typename Traits, typename CharT, typename T>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+char_range<CharT>
+to_char_range(
+  const T& t,
+  std::true_type) noexcept
+{
+  return {t.data(), t.size()};
+}
 
-      Linear in `count`.
+template<typename Traits, typename CharT, typename T>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+char_range<CharT>
+to_char_range(
+  const T& t,
+  std::false_type) noexcept
+{
+  const CharT* s = t;
+  return {s, Traits::length(s)};
+}
 
-      @par Exception Safety
+template<typename Traits, typename CharT, typename T>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+char_range<CharT>
+to_char_range(const T& t) noexcept
+{
+  return to_char_range<Traits, CharT>(t, is_string_like<T, CharT>{});
+}
 
-      Strong guarantee.
+// The capacity needed for a piece of a concatenation,
+// which is fixed if it is known from the type alone
+template<typename T, typename CharT>
+struct concat_capacity
+{
+  static constexpr bool fixed = false;
+  static constexpr std::size_t value = 0;
+};
 
-      @return `*this`
+template<std::size_t M, typename CharT, typename Traits,
+  typename OverflowPolicy>
+struct concat_capacity<
+  basic_static_string<M, CharT, Traits, OverflowPolicy>, CharT>
+{
+  static constexpr bool fixed = true;
+  static constexpr std::size_t value = M;
+};
 
-      @param s A pointer to the string to copy from.
+template<std::size_t M, typename CharT>
+struct concat_capacity<CharT[M], CharT>
+{
+  static constexpr bool fixed = true;
+  static constexpr std::size_t value = M - 1;
+};
 
-      @throw std::length_error `traits_type::length(s) > max_size()`.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator=(const_pointer s)
-  {
-    return assign(s);
-  }
+template<typename CharT>
+struct concat_capacity<CharT, CharT>
+{
+  static constexpr bool fixed = true;
+  static constexpr std::size_t value = 1;
+};
 
-  /** Assign to the string.
+// The character type and traits of a concatenation, which
+// are those of its first piece that is a basic_static_string
+// or a character array, and are void if there is none
+template<typename... Pieces>
+struct concat_traits
+{
+  using char_type = void;
+  using traits_type = void;
+};
 
-      Replaces the contents with a single copy of
-      the character `ch`.
+template<typename T, typename... Pieces>
+struct concat_traits<T, Pieces...>
+  : concat_traits<Pieces...> { };
 
-      @par Complexity
+template<std::size_t M, typename CharT, typename Traits,
+  typename OverflowPolicy, typename... Pieces>
+struct concat_traits<
+  basic_static_string<M, CharT, Traits, OverflowPolicy>, Pieces...>
+{
+  using char_type = CharT;
+  using traits_type = Traits;
+};
 
-      Constant.
+template<std::size_t M, typename CharT, typename... Pieces>
+struct concat_traits<CharT[M], Pieces...>
+{
+  using char_type = CharT;
+  using traits_type = std::char_traits<CharT>;
+};
 
-      @par Exception Safety
+template<typename CharT, typename... Pieces>
+struct concat_capacity_sum
+{
+  static constexpr bool fixed = true;
+  static constexpr std::size_t value = 0;
+};
 
-      Strong guarantee.
+template<typename CharT, typename T, typename... Pieces>
+struct concat_capacity_sum<CharT, T, Pieces...>
+{
+  static constexpr bool fixed =
+    concat_capacity<T, CharT>::fixed &&
+    concat_capacity_sum<CharT, Pieces...>::fixed;
+  static constexpr std::size_t value =
+    concat_capacity<T, CharT>::value +
+    concat_capacity_sum<CharT, Pieces...>::value;
+};
 
-      @return `*this`
+// The character type, traits and total capacity
+// of a concatenation
+template<typename... Pieces>
+struct concat_result
+  : concat_traits<Pieces...>
+{
+  using sum = concat_capacity_sum<
+    typename concat_traits<Pieces...>::char_type, Pieces...>;
+  static constexpr bool fixed = sum::fixed;
+  static constexpr std::size_t capacity = sum::value;
+};
 
-      @param ch The character to assign to.
+// Only an exact CharT is accepted, a value of another type
+// would be converted to a temporary which does not outlive
+// the returned range
+template<typename Traits, typename CharT, typename T,
+  typename std::enable_if<
+    std::is_same<T, CharT>::value>::type* = nullptr>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+char_range<CharT>
+concat_range(const T& ch) noexcept
+{
+  return {&ch, 1};
+}
 
-      @throw std::length_error `count > max_size()`.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator=(value_type ch)
+// A character array holds a null-terminated string,
+// which may fill the whole array
+template<typename Traits, typename CharT, std::size_t M>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+char_range<CharT>
+concat_range(const CharT(&s)[M]) noexcept
+{
+  std::size_t n = 0;
+  while (n < M - 1 && !Traits::eq(s[n], CharT()))
+    ++n;
+  return {s, n};
+}
+
+template<typename Traits, typename CharT, typename T,
+  typename = typename std::enable_if<
+    is_char_range<T, CharT>::value &&
+    !std::is_array<T>::value>::type>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+char_range<CharT>
+concat_range(const T& t) noexcept
+{
+  return to_char_range<Traits, CharT>(t);
+}
+
+// Computes the critical factorization of {s, s + n) used by the
+// Two-Way string matching algorithm (Crochemore and Perrin). Returns
+// the start of the right half and stores the period of that half,
+// found with the larger of the two maximal suffixes.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+std::size_t
+two_way_factorize(
+  const CharT* s,
+  std::size_t n,
+  std::size_t& period) noexcept
+{
+  if (n < 3)
+  {
+    period = 1;
+    return n - 1;
+  }
+  // maximal suffix for the usual order, and then the reverse order.
+  // max starts at -1 so that max + k wraps around to k - 1.
+  std::size_t max_fwd = std::size_t(-1);
+  std::size_t period_fwd = 1;
+  std::size_t max_rev = std::size_t(-1);
+  std::size_t period_rev = 1;
+  for (int rev = 0; rev < 2; ++rev)
+  {
+    std::size_t max = std::size_t(-1);
+    std::size_t j = 0;
+    std::size_t k = 1;
+    std::size_t p = 1;
+    while (j + k < n)
+    {
+      const CharT a = s[j + k];
+      const CharT b = s[max + k];
+      if (rev ? Traits::lt(b, a) : Traits::lt(a, b))
+      {
+        j += k;
+        k = 1;
+        p = j - max;
+      }
+      else if (Traits::eq(a, b))
+      {
+        if (k != p)
+          ++k;
+        else
+        {
+          j += p;
+          k = 1;
+        }
+      }
+      else
+      {
+        max = j++;
+        k = p = 1;
+      }
+    }
+    (rev ? max_rev : max_fwd) = max;
+    (rev ? period_rev : period_fwd) = p;
+  }
+  if (max_rev + 1 < max_fwd + 1)
   {
-    return assign_char(ch,
-      std::integral_constant<bool, (N > 0)>{});
+    period = period_fwd;
+    return max_fwd + 1;
   }
+  period = period_rev;
+  return max_rev + 1;
+}
 
-  /** Assign to the string.
+// Two-Way search for {s, s + n) within {first, last), where suffix
+// and period are the results of two_way_factorize and periodic is
+// whether the left half of the needle is repeated within the right
+// half. Returns last if there is no match. Requires 0 < n.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+two_way_search(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n,
+  std::size_t suffix,
+  std::size_t period,
+  bool periodic) noexcept
+{
+  const std::size_t len = last - first;
+  if (n > len)
+    return last;
+  if (periodic)
+  {
+    // a mismatch in the left half can only advance by the period,
+    // so remember how much of the right half is known to match
+    std::size_t memory = 0;
+    for (std::size_t j = 0; j <= len - n;)
+    {
+      std::size_t i = (std::max)(suffix, memory);
+      while (i < n && Traits::eq(s[i], first[i + j]))
+        ++i;
+      if (i < n)
+      {
+        j += i - suffix + 1;
+        memory = 0;
+        continue;
+      }
+      i = suffix;
+      while (i > memory && Traits::eq(s[i - 1], first[i - 1 + j]))
+        --i;
+      if (i <= memory)
+        return first + j;
+      j += period;
+      memory = n - period;
+    }
+  }
+  else
+  {
+    // the halves are distinct, so any mismatch allows a maximal shift
+    const std::size_t shift = (std::max)(suffix, n - suffix) + 1;
+    for (std::size_t j = 0; j <= len - n;)
+    {
+      std::size_t i = suffix;
+      while (i < n && Traits::eq(s[i], first[i + j]))
+        ++i;
+      if (i < n)
+      {
+        j += i - suffix + 1;
+        continue;
+      }
+      i = suffix;
+      while (i > 0 && Traits::eq(s[i - 1], first[i - 1 + j]))
+        --i;
+      if (!i)
+        return first + j;
+      j += shift;
+    }
+  }
+  return last;
+}
 
-      Replaces the contents with those of the
-      initializer list `ilist`.
+// A 256 bit membership table for a set of single byte characters
+struct byte_set
+{
+  std::uint64_t bits[4];
 
-      @par Complexity
+  byte_set(
+    const unsigned char* s,
+    std::size_t n) noexcept
+    : bits{}
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      bits[s[i] >> 6] |= std::uint64_t(1) << (s[i] & 63);
+  }
 
-      Linear in `init.size()`.
+  bool
+  contains(unsigned char c) const noexcept
+  {
+    return (bits[c >> 6] >> (c & 63)) & 1;
+  }
 
-      @par Exception Safety
+  // The members whose high nibble is h, as a 16 bit mask
+  // indexed by the low nibble.
+  unsigned
+  row(unsigned h) const noexcept
+  {
+    return static_cast<unsigned>(bits[h >> 2] >> ((h & 3) * 16)) & 0xffff;
+  }
+};
 
-      Strong guarantee.
+#ifdef BOOST_STATIC_STRING_HAS_SSSE3
+// Tables for classifying bytes with pshufb: each distinct high
+// nibble in the set is given one of 8 bits, hi maps a high nibble
+// to its bit and lo maps a low nibble to the bits of the high
+// nibbles it is paired with. A byte is a member exactly when
+// lo[low nibble] & hi[high nibble] is non-zero.
+// Returns false if the set has more than 8 distinct high nibbles.
+inline
+bool
+make_nibble_tables(
+  const byte_set& set,
+  unsigned char (&lo)[16],
+  unsigned char (&hi)[16]) noexcept
+{
+  unsigned next = 0;
+  for (unsigned h = 0; h < 16; ++h)
+  {
+    const unsigned row = set.row(h);
+    hi[h] = 0;
+    if (!row)
+      continue;
+    if (next == 8)
+      return false;
+    const auto bit = static_cast<unsigned char>(1u << next++);
+    hi[h] = bit;
+    for (unsigned l = 0; l < 16; ++l)
+      if ((row >> l) & 1)
+        lo[l] |= bit;
+  }
+  return true;
+}
 
-      @return `*this`
+// Mask of the bytes in {p, p + 16) which are not members
+inline
+std::uint32_t
+non_members_ssse3(
+  const unsigned char* p,
+  __m128i lo,
+  __m128i hi) noexcept
+{
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  const __m128i m = _mm_and_si128(
+    _mm_shuffle_epi8(lo, _mm_and_si128(b, nibble)),
+    _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(b, 4), nibble)));
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(
+    _mm_cmpeq_epi8(m, _mm_setzero_si128())));
+}
+#endif
 
-      @param ilist The initializer list to copy from.
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+// Mask of the bytes in {p, p + 32) which are not members
+inline
+std::uint32_t
+non_members_avx2(
+  const unsigned char* p,
+  __m256i lo,
+  __m256i hi) noexcept
+{
+  const __m256i nibble = _mm256_set1_epi8(0x0f);
+  const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  const __m256i m = _mm256_and_si256(
+    _mm256_shuffle_epi8(lo, _mm256_and_si256(b, nibble)),
+    _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(b, 4), nibble)));
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(
+    _mm256_cmpeq_epi8(m, _mm256_setzero_si256())));
+}
+#endif
 
-      @throw std::length_error `ilist.size() > max_size()`.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator=(std::initializer_list<value_type> ilist)
+// Find the first (or last, if Reverse is true) byte in {p, p + n)
+// which is a member of {s, s + count) if Member is true, or which
+// is not a member otherwise. Returns n if there is none.
+template<bool Member, bool Reverse>
+inline
+std::size_t
+find_of_bytes(
+  const unsigned char* p,
+  std::size_t n,
+  const unsigned char* s,
+  std::size_t count) noexcept
+{
+  const byte_set set(s, count);
+  // the positions which remain to be searched are {lo, hi)
+  std::size_t lo = 0;
+  std::size_t hi = n;
+#ifdef BOOST_STATIC_STRING_HAS_SSSE3
+  unsigned char lo_tbl[16] = {};
+  unsigned char hi_tbl[16];
+  if (n >= 16 && make_nibble_tables(set, lo_tbl, hi_tbl))
+  {
+    const __m128i vlo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lo_tbl));
+    const __m128i vhi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi_tbl));
+#ifdef BOOST_STATIC_STRING_HAS_AVX2
+    {
+      const __m256i wlo = _mm256_broadcastsi128_si256(vlo);
+      const __m256i whi = _mm256_broadcastsi128_si256(vhi);
+      for (; hi - lo >= 32; Reverse ? hi -= 32 : lo += 32)
+      {
+        const std::size_t i = Reverse ? hi - 32 : lo;
+        std::uint32_t mask = non_members_avx2(p + i, wlo, whi);
+        if (Member)
+          mask = ~mask;
+        if (mask)
+          return i + (Reverse ? highest_bit(mask) : countr_zero(mask));
+      }
+    }
+#endif
+    for (; hi - lo >= 16; Reverse ? hi -= 16 : lo += 16)
+    {
+      const std::size_t i = Reverse ? hi - 16 : lo;
+      std::uint32_t mask = non_members_ssse3(p + i, vlo, vhi);
+      if (Member)
+        mask = ~mask & 0xffff;
+      if (mask)
+        return i + (Reverse ? highest_bit(mask) : countr_zero(mask));
+    }
+  }
+#endif
+  for (; lo < hi; Reverse ? --hi : ++lo)
   {
-    return assign(ilist);
+    const std::size_t i = Reverse ? hi - 1 : lo;
+    if (set.contains(p[i]) == Member)
+      return i;
   }
+  return n;
+}
 
-  /** Assign to the string.
-
-      Replaces the contents with those of
-      `sv`, where `sv` is `string_view_type(t)`.
+template<bool Member, bool Reverse, typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+find_of_scalar(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n) noexcept
+{
+  if (Reverse)
+  {
+    for (auto it = last; it != first;)
+      if ((Traits::find(s, n, *--it) != nullptr) == Member)
+        return it;
+  }
+  else
+  {
+    for (auto it = first; it != last; ++it)
+      if ((Traits::find(s, n, *it) != nullptr) == Member)
+        return it;
+  }
+  return last;
+}
 
-      @par Complexity
+template<bool Member, bool Reverse, typename Traits, typename CharT>
+inline
+const CharT*
+find_of_runtime(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n,
+  std::false_type) noexcept
+{
+  return find_of_scalar<Member, Reverse, Traits>(first, last, s, n);
+}
 
-      Linear in `sv.size()`.
+template<bool Member, bool Reverse, typename Traits, typename CharT>
+inline
+const CharT*
+find_of_runtime(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n,
+  std::true_type) noexcept
+{
+  return first + find_of_bytes<Member, Reverse>(
+    reinterpret_cast<const unsigned char*>(first), last - first,
+    reinterpret_cast<const unsigned char*>(s), n);
+}
 
-      @par Exception Safety
+// Find the first (or last, if Reverse is true) character in
+// {first, last) which is in {s, s + n) if Member is true, or
+// which is not in it otherwise. Returns last if there is none.
+template<bool Member, bool Reverse, typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+const CharT*
+find_of(
+  const CharT* first,
+  const CharT* last,
+  const CharT* s,
+  std::size_t n) noexcept
+{
+#ifdef BOOST_STATIC_STRING_IS_CONST_EVAL
+  if (!BOOST_STATIC_STRING_IS_CONST_EVAL)
+    return find_of_runtime<Member, Reverse, Traits>(first, last, s, n,
+      std::integral_constant<bool,
+        is_fast_traits<Traits>::value && sizeof(CharT) == 1>{});
+#endif
+  return find_of_scalar<Member, Reverse, Traits>(first, last, s, n);
+}
 
-      Strong guarantee.
+// Exchange the first n characters of two non-overlapping ranges.
+// This goes through a small buffer so that each step is a bulk
+// traits copy instead of a character at a time.
+template<typename Traits, typename CharT>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+void
+swap_ranges(
+  CharT* first1,
+  CharT* first2,
+  std::size_t n) noexcept
+{
+  constexpr std::size_t block_size = 64;
+  CharT buffer[block_size]{};
+  while (n > 0)
+  {
+    const std::size_t count = (std::min)(n, block_size);
+    Traits::copy(buffer, first1, count);
+    Traits::copy(first1, first2, count);
+    Traits::copy(first2, buffer, count);
+    first1 += count;
+    first2 += count;
+    n -= count;
+  }
+}
 
-      @note
+// KRYSTIAN TODO: add a constexpr rotate
 
-      The view can contain null characters.
+// Check if a pointer lies within the range {src_first, src_last)
+// without unspecified behavior, allowing it to be used
+// in a constant evaluation.
+template<typename T>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+ptr_in_range(
+  const T* src_first,
+  const T* src_last,
+  const T* ptr)
+{
+#if defined(BOOST_STATIC_STRING_CPP14) && \
+defined(BOOST_STATIC_STRING_IS_CONST_EVAL)
+  // Our second best option is to use is_constant_evaluated
+  // and a loop that checks for equality, since equality for
+  // pointer to object types is never unspecified in this case.
+  if (BOOST_STATIC_STRING_IS_CONST_EVAL)
+  {
+    for (; src_first != src_last; ++src_first)
+      if (ptr == src_first)
+        return true;
+    return false;
+  }
+#endif
+  // We want to make this usable in constant expressions as much as possible
+  // while retaining the guarentee that the comparison has a strict total ordering.
+  // We also want this to be fast. Since different compilers have differing levels
+  // of conformance, we will settle for the best option that is available.
+  // We don't care about this in C++11, since this function would have
+  // no applications in constant expressions.
+#if defined(BOOST_STATIC_STRING_CPP14) && \
+defined(BOOST_STATIC_STRING_NO_PTR_COMP_FUNCTIONS)
+  // If library comparison functions don't work,
+  // we can use try builtin comparison operators instead.
+  return ptr >= src_first && ptr < src_last;
+#else
+  // Use the library comparison functions if we can't use
+  // is_constant_evaluated or if we don't need to.
+  return std::greater_equal<const T*>()(ptr, src_first) &&
+    std::less<const T*>()(ptr, src_last);
+#endif
+}
 
-      @tparam T A type convertible to `string_view_type`.
+// Computes the total size once, then copies each
+// piece directly into the uninitialized result
+template<std::size_t N, typename CharT,
+  typename Traits, typename... Pieces>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+basic_static_string<N, CharT, Traits>
+concat_impl(const Pieces&... pieces)
+{
+  const char_range<CharT> ranges[] = {
+    concat_range<Traits, CharT>(pieces)...};
+  std::size_t size = 0;
+  for (const auto& r : ranges)
+    size += r.size;
+  if (size > N)
+    throw_exception<std::length_error>(
+      "size > max_size()");
+  basic_static_string<N, CharT, Traits> result(uninitialized);
+  CharT* out = result.data();
+  for (const auto& r : ranges)
+  {
+    Traits::copy(out, r.data, r.size);
+    out += r.size;
+  }
+  string_access::set_size(result, size);
+  return result;
+}
 
-      @par Constraints
+// Computes the total size in a first pass over the
+// range, then copies each element and separator
+// directly into the uninitialized result
+template<std::size_t N, typename CharT,
+  typename Traits, typename Range>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+basic_static_string<N, CharT, Traits>
+join_impl(
+  const Range& range,
+  const CharT* sep,
+  std::size_t sep_size)
+{
+  std::size_t size = 0;
+  bool first = true;
+  for (const auto& piece : range)
+  {
+    size += concat_range<Traits, CharT>(piece).size +
+      (first ? 0 : sep_size);
+    if (size > N)
+      throw_exception<std::length_error>(
+        "size > max_size()");
+    first = false;
+  }
+  basic_static_string<N, CharT, Traits> result(uninitialized);
+  CharT* out = result.data();
+  first = true;
+  for (const auto& piece : range)
+  {
+    if (!first)
+    {
+      Traits::copy(out, sep, sep_size);
+      out += sep_size;
+    }
+    const auto r = concat_range<Traits, CharT>(piece);
+    Traits::copy(out, r.data, r.size);
+    out += r.size;
+    first = false;
+  }
+  string_access::set_size(result, size);
+  return result;
+}
 
-      @code
-      std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value
-      @endcode
+// Exposes the get area of a stream buffer, so that input
+// can be scanned and copied in bulk rather than per character.
+// Naming the protected members through the derived class
+// yields pointers to members of the base class.
+template<typename CharT, typename Traits>
+struct streambuf_access
+  : std::basic_streambuf<CharT, Traits>
+{
+  using base = std::basic_streambuf<CharT, Traits>;
 
-      @return `*this`
+  // Makes a character available, returning false at the end of the input
+  static
+  bool
+  fill(base& sb)
+  {
+    return !Traits::eq_int_type(sb.sgetc(), Traits::eof());
+  }
 
-      @param t The object to assign from.
+  // The available characters, which are at
+  // most the largest value gbump accepts
+  static
+  std::size_t
+  available(base& sb) noexcept
+  {
+    const std::size_t n = (sb.*&streambuf_access::egptr)() -
+      (sb.*&streambuf_access::gptr)();
+    return (std::min)(n, std::size_t(
+      (std::numeric_limits<int>::max)()));
+  }
 
-      @throw std::length_error `sv.size() > max_size()`.
-  */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator=(const T& t)
+  static
+  const CharT*
+  next(base& sb) noexcept
   {
-    return assign(t);
+    return (sb.*&streambuf_access::gptr)();
   }
 
-  /** Assign to the string.
+  static
+  void
+  consume(
+    base& sb,
+    std::size_t n) noexcept
+  {
+    (sb.*&streambuf_access::gbump)(static_cast<int>(n));
+  }
+};
 
-      Replaces the contents with `count` copies of
-      character `ch`.
+// Appends characters from sb to str until find returns a
+// position before the end of the characters passed to it,
+// the input ends, or str is full. Returns true in the first
+// case, leaving the character at that position unextracted.
+template<std::size_t N, typename CharT,
+  typename Traits,
+  typename OverflowPolicy, typename Find>
+inline
+bool
+read_until(
+  std::basic_streambuf<CharT, Traits>& sb,
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& str,
+  std::ios_base::iostate& state,
+  Find find)
+{
+  using access = streambuf_access<CharT, Traits>;
+  for (;;)
+  {
+    if (!access::fill(sb))
+    {
+      state |= std::ios_base::eofbit;
+      return false;
+    }
+    const CharT* first = access::next(sb);
+    std::size_t avail = access::available(sb);
+    // an unbuffered stream is read one character at a time
+    CharT ch = CharT();
+    const bool buffered = avail != 0;
+    if (!buffered)
+    {
+      ch = Traits::to_char_type(sb.sgetc());
+      first = &ch;
+      avail = 1;
+    }
+    const CharT* const hit = find(first, first + avail);
+    const std::size_t room = N - str.size();
+    const std::size_t n = (std::min)(
+      static_cast<std::size_t>(hit - first), room);
+    Traits::copy(str.data() + str.size(), first, n);
+    string_access::set_size(str, str.size() + n);
+    if (buffered)
+      access::consume(sb, n);
+    else if (n)
+      sb.sbumpc();
+    if (first + n == hit && hit != first + avail)
+      return true;
+    if (n == room && n != avail)
+      return false;
+  }
+}
 
-      @par Complexity
+// Runs the extraction f, which returns the state to set
+// on is. If the stream buffer throws, sets badbit without
+// throwing std::ios_base::failure, and rethrows if badbit
+// is set in is.exceptions(), as the std::string
+// extractors do.
+template<typename CharT, typename Traits, typename F>
+void
+guarded_extract(
+  std::basic_istream<CharT, Traits>& is,
+  F f)
+{
+#ifndef BOOST_STATIC_STRING_NO_EXCEPTIONS
+  std::ios_base::iostate state;
+  try
+  {
+    state = f();
+  }
+  catch (...)
+  {
+    const std::ios_base::iostate mask = is.exceptions();
+    is.exceptions(std::ios_base::goodbit);
+    is.setstate(std::ios_base::badbit);
+    if (!(mask & std::ios_base::badbit))
+    {
+      is.exceptions(mask);
+      return;
+    }
+    try
+    {
+      is.exceptions(mask);
+    }
+    catch (const std::ios_base::failure&)
+    {
+    }
+    throw;
+  }
+  is.setstate(state);
+#else
+  is.setstate(f());
+#endif
+}
 
-      Linear in `count`.
+#ifdef BOOST_STATIC_STRING_HAS_FORMAT
+// An output iterator which writes directly to the
+// storage of a string, reporting an overflow through
+// its policy when the string is full. The size and
+// null terminator are only written by commit, once
+// formatting has finished.
+template<typename String>
+class format_iterator
+{
+  using char_type = typename String::value_type;
 
-      @par Exception Safety
+  String* s_;
+  char_type* cursor_;
 
-      Strong guarantee.
+public:
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = void;
 
-      @return `*this`
+  explicit
+  format_iterator(String& s) noexcept
+    : s_(&s)
+    , cursor_(s.data() + s.size())
+  {
+  }
 
-      @param count The size of the resulting string.
+  format_iterator&
+  operator=(char_type ch)
+  {
+    if (cursor_ == s_->data() + s_->max_size())
+      string_access::report_overflow(*s_, "size() == max_size()");
+    else
+      String::traits_type::assign(*cursor_++, ch);
+    return *this;
+  }
 
-      @param ch The value to initialize characters
-      of the string with.
+  // Sets the size of the string to the
+  // characters written through the iterator
+  void
+  commit() const noexcept
+  {
+    string_access::set_size(*s_, cursor_ - s_->data());
+  }
 
-      @throw std::length_error `count > max_size()`.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(
-    size_type count,
-    value_type ch);
+  format_iterator&
+  operator*() noexcept
+  {
+    return *this;
+  }
 
-  /** Assign to the string.
+  format_iterator&
+  operator++() noexcept
+  {
+    return *this;
+  }
 
-      Replaces the contents with those of
-      the string `s`.
+  format_iterator&
+  operator++(int) noexcept
+  {
+    return *this;
+  }
+};
 
-      @par Complexity
+// The format string is checked at compile time
+// when the standard library exposes the type
+#if __cpp_lib_format >= 202207L
+template<typename... Args>
+using format_string = std::format_string<Args...>;
 
-      Linear in `s.size()`.
+template<typename... Args>
+using wformat_string = std::wformat_string<Args...>;
 
-      @par Exception Safety
+template<typename CharT, typename... Args>
+inline
+std::basic_string_view<CharT>
+format_view(std::basic_format_string<CharT, Args...> fmt) noexcept
+{
+  return fmt.get();
+}
+#else
+template<typename... Args>
+using format_string = std::string_view;
 
-      Strong guarantee.
+template<typename... Args>
+using wformat_string = std::wstring_view;
 
-      @tparam M The size of the other string.
+template<typename CharT>
+inline
+std::basic_string_view<CharT>
+format_view(std::basic_string_view<CharT> fmt) noexcept
+{
+  return fmt;
+}
+#endif
+#endif
 
-      @return `*this`
+} // detail
+#endif
 
-      @param s The string to replace
-      the contents with.
+//--------------------------------------------------------------------------
+//
+// Overflow policies
+//
+//--------------------------------------------------------------------------
 
-      @throw std::length_error `s.size() > max_size()`.
+/** The default overflow policy.
+
+    An operation which would make the size of the string
+    exceed its capacity throws `std::length_error` and
+    leaves the string unchanged.
+
+    @par Overflow Policies
+
+    The overflow policy is the last template parameter of
+    @ref basic_static_string, and is used as a base class
+    of the string, so a policy without data members takes
+    up no space. A policy type provides:
+
+    @li A constant `checked` of type `bool`. When it is
+    `false`, capacity checks are replaced by assertions,
+    and no check at all is performed when assertions are
+    disabled; exceeding the capacity is then undefined
+    behavior.
+
+    @li A member function `on_overflow(const char* msg)`,
+    called when `checked` is `true` and an operation would
+    exceed the capacity. If it returns, the operation is
+    carried out with as many of the new characters as
+    fit, and the remaining ones are discarded.
+
+    @see truncate_on_overflow, saturate_on_overflow,
+    assert_on_overflow
+*/
+struct throw_on_overflow
+{
+  /// Capacity checks are performed.
+  static constexpr bool checked = true;
+
+  /** Throws `std::length_error`.
+
+      This is a template so that the throw is only
+      instantiated when the policy is used, and code
+      using other policies builds without exceptions.
   */
-  template<std::size_t M
-#ifndef BOOST_STATIC_STRING_DOCS
-  , typename std::enable_if<(M < N)>::type* = nullptr
-#endif
-  >
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(const basic_static_string<M, CharT, Traits>& s)
+  template<typename Exception = std::length_error>
+  BOOST_STATIC_STRING_NORETURN
+  static
+  void
+  on_overflow(const char* msg)
   {
-    return assign_unchecked(s.data(), s.size());
+    detail::throw_exception<Exception>(msg);
   }
+};
 
-#ifndef BOOST_STATIC_STRING_DOCS
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(const basic_static_string& s) noexcept
-  {
-    if (data() == s.data())
-      return *this;
-    return assign_unchecked(s.data(), s.size());
-  }
+/** An overflow policy which silently truncates.
 
-  template<std::size_t M,
-    typename std::enable_if<(M > N)>::type* = nullptr>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(const basic_static_string<M, CharT, Traits>& s)
-  {
-    return assign(s.data(), s.size());
-  }
-#endif
+    An operation which would make the size of the string
+    exceed its capacity is carried out with as many of
+    the new characters as fit, and the rest are discarded.
+    Numbers are appended whole, or not at all.
 
-  /** Assign to the string.
+    @par Example
 
-      Replaces the contents with those of the string `sub`,
-      where `sub` is `s.substr(pos, count)`.
+    @code
+    basic_static_string<8, char,
+      std::char_traits<char>, truncate_on_overflow> s;
+    s.append("truncated output"); // s == "truncate"
+    @endcode
 
-      @par Complexity
+    @see throw_on_overflow
+*/
+struct truncate_on_overflow
+{
+  /// Capacity checks are performed.
+  static constexpr bool checked = true;
 
-      Linear in `sub.size()`.
+  /// Does nothing.
+  static
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  on_overflow(const char*) noexcept
+  {
+  }
+};
 
-      @par Exception Safety
+/** An overflow policy which truncates and remembers it.
 
-      Strong guarantee.
+    Behaves like @ref truncate_on_overflow, and in addition
+    sets a flag which stays set until it is cleared, so
+    that a sequence of operations can be checked once at
+    the end. The flag is accessed through
+    @ref basic_static_string::overflow_policy, and adds
+    a `bool` to the size of the string. Copying, moving
+    or assigning a string carries the flag along with
+    the contents, while swapping leaves each flag with
+    its string.
 
-      @tparam M The capacity of the other string.
+    @par Example
 
-      @return `*this`
+    @code
+    basic_static_string<16, char,
+      std::char_traits<char>, saturate_on_overflow> s;
+    s.append(name).append(": ").append_number(value);
+    if(s.overflow_policy().overflowed())
+      handle_truncation();
+    @endcode
 
-      @param s The string to replace
-      the contents with.
+    @see throw_on_overflow
+*/
+struct saturate_on_overflow
+{
+  /// Capacity checks are performed.
+  static constexpr bool checked = true;
 
-      @param pos The index at which to begin the substring.
+  /// Sets the overflow flag.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  on_overflow(const char*) noexcept
+  {
+    overflowed_ = true;
+  }
 
-      @param count The size of the substring. The default
-      argument for this parameter is @ref npos.
+  /// Return `true` if an overflow occurred since the flag was last cleared.
+  constexpr
+  bool
+  overflowed() const noexcept
+  {
+    return overflowed_;
+  }
 
-      @throw std::length_error `sub.size() > max_size()`.
-  */
-  template<std::size_t M>
+  /// Clear the overflow flag.
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(
-    const basic_static_string<M, CharT, Traits>& s,
-    size_type pos,
-    size_type count = npos)
+  void
+  clear_overflow() noexcept
   {
-    return assign(s.data() + pos, s.capped_length(pos, count));
+    overflowed_ = false;
   }
 
-  /** Assign to the string.
+private:
+  bool overflowed_ = false;
+};
 
-      Replaces the contents with those of `{s, s + count)`.
+/** An overflow policy which only asserts.
 
-      @par Complexity
+    Capacity checks are replaced by assertions, which
+    are compiled out in release builds. Exceeding the
+    capacity of the string is a precondition violation,
+    and results in undefined behavior when assertions
+    are disabled.
 
-      Linear in `count`.
+    This policy is meant for code where the sizes are
+    known to fit, and the checks are not wanted on
+    hot paths.
 
-      @par Exception Safety
+    @see throw_on_overflow
+*/
+struct assert_on_overflow
+{
+  /// Capacity checks are replaced by assertions.
+  static constexpr bool checked = false;
+};
 
-      Strong guarantee.
+//--------------------------------------------------------------------------
+//
+// static_string_searcher
+//
+//--------------------------------------------------------------------------
 
-      @note
+/** A precompiled substring searcher.
 
-      The range can contain null characters.
+    Holds a needle together with the data needed to search
+    for it, so that the same needle can be searched for in
+    many strings without repeating that work. Short needles
+    are searched for using the same character filter as
+    @ref basic_static_string::find, and longer needles
+    using the Two-Way algorithm, which runs in linear time
+    and constant space.
 
-      @return `*this`
+    The searcher refers to the characters of the needle,
+    which must remain valid for as long as it is used.
 
-      @param count The number of characters to copy.
+    Construction is `constexpr` in C++17 and later, or
+    with any traits type whose `compare` is `constexpr`;
+    `std::char_traits<CharT>::compare` is not `constexpr`
+    before C++17.
 
-      @param s A pointer to the string to copy from.
+    @par Example
 
-      @throw std::length_error `count > max_size()`.
-    */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(
-    const_pointer s,
-    size_type count);
+    @code
+    const static_string_searcher<char> searcher("needle", 6);
+    static_string<64> s = "haystack with a needle";
+    auto pos = s.find(searcher); // 16
+    @endcode
 
-  /** Assign to the string.
+    In C++17 and later, the searcher can also be
+    built at compile time:
 
-      Replaces the contents with those of
-      `{s, s + traits_type::length(s))`.
+    @code
+    constexpr static_string_searcher<char> searcher("needle", 6);
+    @endcode
 
-      @par Complexity
+    @see basic_static_string::find
+*/
+template<typename CharT,
+  typename Traits = std::char_traits<CharT>>
+class static_string_searcher
+{
+public:
+  /// The traits type.
+  using traits_type = Traits;
 
-      Linear in `count`.
+  /// The character type.
+  using value_type = typename traits_type::char_type;
 
-      @par Exception Safety
+  /// The size type.
+  using size_type = std::size_t;
 
-      Strong guarantee.
+  /// The constant pointer type.
+  using const_pointer = const value_type*;
 
-      @return `*this`
+  /** Construct a searcher.
 
-      @param s A pointer to the string to copy from.
+      Constructs a searcher for the string `{s, s + n)`.
 
-      @throw std::length_error `traits_type::length(s) > max_size()`.
+      @par Complexity
+
+      Linear in `n`.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(const_pointer s)
+  static_string_searcher(
+    const_pointer s,
+    size_type n) noexcept
+    : s_(s), n_(n)
   {
-    return assign(s, traits_type::length(s));
+    if (n_)
+    {
+      suffix_ = detail::two_way_factorize<Traits>(s_, n_, period_);
+      periodic_ = period_ <= n_ - suffix_ &&
+        !traits_type::compare(s_, s_ + period_, suffix_);
+    }
   }
 
-  /** Assign to the string.
+  /** Construct a searcher.
 
-      Replaces the contents with the characters
-      in the range `{first, last)`.
+      Constructs a searcher for the null-terminated
+      string pointed to by `s`.
 
       @par Complexity
 
-      Linear in `std::distance(first, last)`.
+      Linear in `traits_type::length(s)`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  explicit
+  static_string_searcher(const_pointer s) noexcept
+    : static_string_searcher(s, traits_type::length(s))
+  {
+  }
 
-      @par Exception Safety
+  /// Return a pointer to the needle.
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  const_pointer
+  data() const noexcept
+  {
+    return s_;
+  }
 
-      Strong guarantee.
+  /// Return the size of the needle.
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  size_type
+  size() const noexcept
+  {
+    return n_;
+  }
 
-      @tparam InputIterator The type of the iterators.
-
-      @par Constraints
-
-      `InputIterator` satisfies __InputIterator__.
-
-      @return `*this`
-
-      @param first An iterator referring to the
-      first character to assign.
-
-      @param last An iterator past the end
-      of the range to assign from.
-
-      @throw std::length_error `std::distance(first, last) > max_size()`.
-  */
-  template<typename InputIterator>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-#ifdef BOOST_STATIC_STRING_DOCS
-  basic_static_string&
-#else
-  typename std::enable_if<
-    detail::is_input_iterator<InputIterator>::value,
-      basic_static_string&>::type
-#endif
-  assign(
-    InputIterator first,
-    InputIterator last);
+  /** Search for the needle.
 
-  /** Assign to the string.
-
-      Replaces the contents with those of the
-      initializer list `ilist`.
+      Finds the first occurrence of the needle
+      within `{first, last)`.
 
       @par Complexity
 
-      Linear in `init.size()`.
-
-      @par Exception Safety
-
-      Strong guarantee.
-
-      @return `*this`
-
-      @param ilist The initializer list to copy from.
+      Linear in `last - first`.
 
-      @throw std::length_error `ilist.size() > max_size()`.
+      @return A pair of pointers to the beginning and end of
+      the first match if one exists, and `{last, last}` otherwise.
+      If the needle is empty, `{first, first}` is returned.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(
-    std::initializer_list<value_type> ilist)
+  std::pair<const_pointer, const_pointer>
+  operator()(
+    const_pointer first,
+    const_pointer last) const noexcept
   {
-    return assign(ilist.begin(), ilist.end());
+    if (!n_)
+      return {first, first};
+    if (static_cast<size_type>(last - first) < n_)
+      return {last, last};
+    const auto res = n_ <= short_needle ?
+      detail::search_chars<Traits>(first, last, s_, n_) :
+      detail::two_way_search<Traits>(
+        first, last, s_, n_, suffix_, period_, periodic_);
+    return {res, res == last ? last : res + n_};
   }
 
-  /** Assign to the string.
+private:
+  // Needles of at most this length use the character filter,
+  // whose worst case is still linear for them.
+  static constexpr size_type short_needle = 32;
+
+  const_pointer s_;
+  size_type n_;
+  size_type suffix_ = 0;
+  size_type period_ = 1;
+  bool periodic_ = false;
+};
 
-      Replaces the contents with those of
-      `sv`, where `sv` is `string_view_type(t)`.
+//--------------------------------------------------------------------------
+//
+// static_string
+//
+//--------------------------------------------------------------------------
 
-      @par Complexity
+/** A fixed-capacity string.
 
-      Linear in `sv.size()`.
+    These objects behave like `std::string` except that the storage
+    is not dynamically allocated but rather fixed in size, and
+    stored in the object itself.
 
-      @par Exception Safety
+    These strings offer performance advantages when an algorithm
+    can execute with a reasonable upper limit on the size of a value.
 
-      Strong guarantee.
+    @par Overflow Policy
+
+    By default, an operation which would exceed the capacity
+    throws `std::length_error`. The `OverflowPolicy` parameter
+    selects a different behavior: @ref truncate_on_overflow
+    and @ref saturate_on_overflow keep the characters which
+    fit, and @ref assert_on_overflow removes the checks from
+    release builds. The `@throw std::length_error` clauses
+    of the member functions apply to the default policy.
+    Member functions taking another `basic_static_string`
+    require it to have the same policy, and accept a string
+    with a different policy through its string view. The
+    comparison operators and `operator+` accept strings with
+    any policies, and the result of `operator+` has the
+    policy of the left operand.
 
-      @note
+    @par Aliases
 
-      The view can contain null characters.
+    The following alias templates are provided for convenience:
 
-      @tparam T A type convertible to `string_view_type`.
+    @code
+    template<std::size_t N>
+    using static_string =
+      basic_static_string<N, char, std::char_traits<char>>;
+    @endcode
 
-      @par Constraints
+    @code
+    template<std::size_t N>
+    using static_wstring =
+      basic_static_string<N, wchar_t, std::char_traits<wchar_t>>;
+    @endcode
 
-      @code
-      std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value
-      @endcode
+    @code
+    template<std::size_t N>
+    using static_u16string =
+      basic_static_string<N, char16_t, std::char_traits<char16_t>>;
+    @endcode
 
-      @return `*this`
+    @code
+    template<std::size_t N>
+    using static_u32string =
+      basic_static_string<N, char32_t, std::char_traits<char32_t>>;
+    @endcode
 
-      @param t The object to assign from.
+    Addtionally, the alias template `static_u8string` is provided in C++20
 
-      @throw std::length_error `sv.size() > max_size()`.
-  */
-  template<typename T
+    @code
+    template<std::size_t N>
+    using static_u8string =
+      basic_static_string<N, char8_t, std::char_traits<char8_t>>;
+    @endcode
+
+    @see to_static_string
+*/
+template<std::size_t N, typename CharT,
+  typename Traits = std::char_traits<CharT>,
+#ifdef BOOST_STATIC_STRING_DOCS
+  typename OverflowPolicy = throw_on_overflow>
+#else
+  typename OverflowPolicy>
+#endif
+class basic_static_string
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+  : private detail::static_string_base<N, CharT, Traits>
+  , private OverflowPolicy
 #endif
-  >
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign(const T& t)
-  {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return assign(sv.data(), sv.size());
-  }
-
-  /** Assign to the string.
+{
+private:
+  template<std::size_t, class, class, class>
+  friend class basic_static_string;
 
-      Replaces the contents with those of the substring `sv`,
-      where `sv` is `string_view_type(t).substr(pos, count)`.
+  friend struct detail::string_access;
+public:
+  //--------------------------------------------------------------------------
+  //
+  // Member types
+  //
+  //--------------------------------------------------------------------------
 
-      @par Complexity
+  /// The traits type.
+  using traits_type = Traits;
 
-      Linear in `sv.size()`.
+  /// The overflow policy type.
+  using overflow_policy_type = OverflowPolicy;
 
-      @par Exception Safety
+  /// The character type.
+  using value_type = typename traits_type::char_type;
 
-      Strong guarantee.
+  /// The size type.
+  using size_type = std::size_t;
 
-      @note
+  /// The difference type.
+  using difference_type = std::ptrdiff_t;
 
-      The view can contain null characters.
+  /// The pointer type.
+  using pointer = value_type*;
 
-      @tparam T A type convertible to `string_view_type`.
+  /// The reference type.
+  using reference = value_type&;
 
-      @par Constraints
+  /// The constant pointer type.
+  using const_pointer = const value_type*;
 
-      @code
-      std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value
-      @endcode
+  /// The constant reference type.
+  using const_reference = const value_type&;
 
-      @return `*this`
+  /// The iterator type.
+  using iterator = value_type*;
 
-      @param t The object to assign from.
+  /// The constant iterator type.
+  using const_iterator = const value_type*;
 
-      @param pos The index at which to begin the substring.
+  /// The reverse iterator type.
+  using reverse_iterator =
+    std::reverse_iterator<iterator>;
 
-      @param count The size of the substring. The default
-      argument for this parameter is @ref npos.
+  /// The constant reverse iterator type.
+  using const_reverse_iterator =
+    std::reverse_iterator<const_iterator>;
 
-      @throw std::length_error `sv.size() > max_size()`.
-  */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+  /// The string view type.
+  using string_view_type =
+    basic_string_view<value_type, traits_type>;
 #endif
-  >
-  basic_static_string&
-  assign(
-    const T& t,
-    size_type pos,
-    size_type count = npos)
-  {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    if( pos > sv.size() )
-      detail::throw_exception<std::out_of_range>(
-          "pos >= t.size()");
-    std::size_t rlen = (std::min)( count, sv.size() - pos );
-    return assign(sv.data() + pos, rlen);
-  }
 
   //--------------------------------------------------------------------------
   //
-  // Element access
+  // Constants
   //
   //--------------------------------------------------------------------------
 
-  /** Access a character with bounds checking.
-
-      Returns a reference to the character at
-      index `pos`.
-
-      @par Complexity
-
-      Constant.
+  /// Maximum size of the string excluding any null terminator
+  static constexpr size_type static_capacity = N;
 
-      @par Exception Safety
+  /// A special index
+  static constexpr size_type npos = size_type(-1);
 
-      Strong guarantee.
+  //--------------------------------------------------------------------------
+  //
+  // Construction
+  //
+  //--------------------------------------------------------------------------
 
-      @param pos The index to access.
+  /** Constructor.
 
-      @throw std::out_of_range `pos >= size()`
+      Construct an empty string
   */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  reference
-  at(size_type pos)
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  basic_static_string() noexcept
   {
-    if (pos >= size())
-      detail::throw_exception<std::out_of_range>(
-        "pos >= size()");
-    return data()[pos];
+#ifdef BOOST_STATIC_STRING_CPP20
+    term();
+#endif
   }
 
-  /** Access a character with bounds checking.
+  /** Constructor.
 
-      Returns a reference to the character at
-      index `pos`.
+      Construct an empty string without initializing the
+      storage past the null terminator. This avoids the cost
+      of zero filling the entire buffer when the string will
+      be written to before it is read.
 
       @par Complexity
 
       Constant.
 
-      @par Exception Safety
+      @note This constructor can only be used in a constant
+      expression in C++20, where the buffer is zero filled.
+  */
+  BOOST_STATIC_STRING_CPP20_CONSTEXPR
+  explicit
+  basic_static_string(uninitialized_t) noexcept
+#ifndef BOOST_STATIC_STRING_DOCS
+    : detail::static_string_base<N, CharT, Traits>(uninitialized)
+#endif
+  {
+    term();
+  }
 
-      Strong guarantee.
+  /** Constructor.
 
-      @param pos The index to access.
+      Construct the string with `count` copies of character `ch`.
 
-      @throw std::out_of_range `pos >= size()`
+      The behavior is undefined if `count >= npos`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_reference
-  at(size_type pos) const
+  basic_static_string(
+    size_type count,
+    value_type ch)
   {
-    if (pos >= size())
-      detail::throw_exception<std::out_of_range>(
-        "pos >= size()");
-    return data()[pos];
+    assign(count, ch);
   }
 
-  /** Access a character.
-
-      Returns a reference to the character at
-      index `pos`.
-
-      @par Complexity
-
-      Constant.
+  /** Constructor.
 
-      @par Precondition
+      Construct with a substring (pos, other.size()) of `other`.
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& other,
+    size_type pos)
+  {
+    assign(other, pos);
+  }
 
-      `pos >= size`
+  /** Constructor.
 
-      @param pos The index to access.
+      Construct with a substring (pos, count) of `other`.
   */
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  reference
-  operator[](size_type pos) noexcept
+  basic_static_string(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& other,
+    size_type pos,
+    size_type count)
   {
-    return data()[pos];
+    assign(other, pos, count);
   }
 
-  /** Access a character.
-
-      Returns a reference to the character at
-      index `pos`.
+  /** Constructor.
 
-      @par Complexity
+      Construct with the first `count` characters of `s`, including nulls.
+    */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string(
+    const_pointer s,
+    size_type count)
+  {
+    assign(s, count);
+  }
 
-      Constant.
+  /** Constructor.
 
-      @par Precondition
+      Construct from a null terminated string.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string(const_pointer s)
+  {
+    assign(s);
+  }
 
-      `pos >= size`
+  /** Constructor.
 
-      @param pos The index to access.
+      Construct from a range of characters
   */
+  template<typename InputIterator
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename std::enable_if<
+      detail::is_input_iterator<InputIterator>
+        ::value>::type* = nullptr
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_reference
-  operator[](size_type pos) const noexcept
+  basic_static_string(
+    InputIterator first,
+    InputIterator last)
   {
-    return data()[pos];
+    // KRYSTIAN TODO: we can use a better algorithm if this is a forward iterator
+    assign(first, last);
   }
 
-  /** Return the first character.
+  /** Constructor.
 
-      Returns a reference to the first character.
+      Copy constructor. The overflow policy is copied
+      from `other`, so the state of a stateful policy
+      such as @ref saturate_on_overflow is preserved.
 
       @par Complexity
 
-      Constant.
-
-      @par Precondition
-
-      `not empty()`
+      Linear in `other.size()`. Prior to C++20, the storage
+      is zero filled before copying so that the constructor
+      can be used in constant expressions.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  reference
-  front() noexcept
+  basic_static_string(const basic_static_string& other) noexcept
+#ifndef BOOST_STATIC_STRING_DOCS
+#ifdef BOOST_STATIC_STRING_CPP20
+    : detail::static_string_base<N, CharT, Traits>(uninitialized)
+#else
+    : detail::static_string_base<N, CharT, Traits>()
+#endif
+    , OverflowPolicy(other)
+#endif
   {
-    return data()[0];
+    this->set_size(other.size());
+    traits_type::copy(data(), other.data(), size());
+    term();
   }
 
-  /** Return the first character.
+  /** Constructor.
 
-      Returns a reference to the first character.
+      Move constructor. Since the characters are stored within
+      the object itself, this copies the contents and the
+      overflow policy of `other`, which is left unchanged.
 
       @par Complexity
 
-      Constant.
+      Linear in `other.size()`. Prior to C++20, the storage
+      is zero filled before copying so that the constructor
+      can be used in constant expressions.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string(basic_static_string&& other) noexcept
+#ifndef BOOST_STATIC_STRING_DOCS
+#ifdef BOOST_STATIC_STRING_CPP20
+    : detail::static_string_base<N, CharT, Traits>(uninitialized)
+#else
+    : detail::static_string_base<N, CharT, Traits>()
+#endif
+    , OverflowPolicy(other)
+#endif
+  {
+    this->set_size(other.size());
+    traits_type::copy(data(), other.data(), size());
+    term();
+  }
 
-      @par Precondition
+  /** Constructor.
 
-      `not empty()`
+      Copy constructor.
   */
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_reference
-  front() const noexcept
+  basic_static_string(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& other)
   {
-    return data()[0];
+    assign(other);
   }
 
-  /** Return the last character.
+  /** Constructor.
 
-      Returns a reference to the last character.
+      Construct from an initializer list
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string(std::initializer_list<value_type> init)
+  {
+    assign(init.begin(), init.size());
+  }
 
-      @par Complexity
+  /** Constructor.
 
-      Constant.
+      Construct from a object convertible to `string_view_type`
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  explicit
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string(const T& t)
+  {
+    assign(t);
+  }
 
-      @par Precondition
+  /** Constructor.
 
-      `not empty()`
+      Construct from any object convertible to `string_view_type`.
+
+      The range (pos, n) is extracted from the value
+      obtained by converting `t` to `string_view_type`,
+      and used to construct the string.
   */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  reference
-  back() noexcept
+  basic_static_string(
+    const T& t,
+    size_type pos,
+    size_type n)
   {
-    return data()[size() - 1];
+    assign(t, pos, n);
   }
 
-  /** Return the last character.
+  //--------------------------------------------------------------------------
+  //
+  // Assignment
+  //
+  //--------------------------------------------------------------------------
 
-      Returns a reference to the last character.
+  /** Assign to the string.
+
+      Replaces the contents with those of
+      the string `s`, and the overflow policy with
+      that of `s`.
 
       @par Complexity
 
-      Constant.
+      Linear in `s.size()`.
 
-      @par Precondition
+      @par Exception Safety
 
-      `not empty()`
+      Strong guarantee.
+
+      @return `*this`
+
+      @param s The string to replace
+      the contents with.
+
+      @throw std::length_error `s.size() > max_size()`.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_reference
-  back() const noexcept
+  basic_static_string&
+  operator=(const basic_static_string& s)
   {
-    return data()[size() - 1];
+    overflow_policy() = s.overflow_policy();
+    return assign(s);
   }
 
-  /** Return a pointer to the string.
+  /** Assign to the string.
 
-      Returns a pointer to the underlying array
-      serving as storage. The value returned is such that
-      the range `{data(), data() + size())` is always a
-      valid range, even if the container is empty.
+      Replaces the contents and the overflow policy
+      with those of the string `s`, which is left
+      unchanged.
 
       @par Complexity
 
-      Constant.
+      Linear in `s.size()`.
 
-      @note The value returned from this function
-      is never never a null pointer value.
+      @return `*this`
+
+      @param s The string to replace
+      the contents with.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  pointer
-  data() noexcept
+  basic_static_string&
+  operator=(basic_static_string&& s) noexcept
   {
-    return this->data_impl();
+    overflow_policy() = s.overflow_policy();
+    return assign(s);
   }
 
-  /** Return a pointer to the string.
+  /** Assign to the string.
 
-      Returns a pointer to the underlying array
-      serving as storage. The value returned is such that
-      the range `{data(), data() + size())` is always a
-      valid range, even if the container is empty.
+      Replaces the contents with those of
+      the string `s`.
 
       @par Complexity
 
-      Constant.
+      Linear in `s.size()`.
 
-      @note The value returned from this function
-      is never never a null pointer value.
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @tparam M The size of the other string.
+
+      @return `*this`
+
+      @param s The string to replace
+      the contents with.
+
+      @throw std::length_error `s.size() > max_size()`.
   */
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_pointer
-  data() const noexcept
+  basic_static_string&
+  operator=(const basic_static_string<M, CharT, Traits, OverflowPolicy>& s)
   {
-    return this->data_impl();
+    return assign(s);
   }
 
-  /** Return a pointer to the string.
+  /** Assign to the string.
 
-      Returns a pointer to the underlying array
-      serving as storage. The value returned is such that
-      the range `{c_str(), c_str() + size())` is always a
-      valid range, even if the container is empty.
+      Replaces the contents with those of
+      `{s, s + traits_type::length(s))`.
 
       @par Complexity
 
-      Constant.
+      Linear in `count`.
 
-      @note The value returned from this function
-      is never never a null pointer value.
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @return `*this`
+
+      @param s A pointer to the string to copy from.
+
+      @throw std::length_error `traits_type::length(s) > max_size()`.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_pointer
-  c_str() const noexcept
+  basic_static_string&
+  operator=(const_pointer s)
   {
-    return data();
+    return assign(s);
   }
 
-#ifdef BOOST_STATIC_STRING_DOCS
-  /** Convert to a string view referring to the string.
+  /** Assign to the string.
 
-      Returns a string view referring to the
-      underlying character string.
+      Replaces the contents with a single copy of
+      the character `ch`.
 
       @par Complexity
 
       Constant.
-  */
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  operator string_view_type() const noexcept
-  {
-    return string_view_type(data(), size());
-  }
-#else
-#ifdef BOOST_STATIC_STRING_HAS_STD_STRING_VIEW
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  operator std::basic_string_view<CharT, Traits>() const noexcept
-  {
-    return std::basic_string_view<CharT, Traits>(data(), size());
-  }
-#endif
-#ifndef BOOST_STATIC_STRING_STANDALONE
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  operator ::boost::basic_string_view<CharT, Traits>() const noexcept
-  {
-    return ::boost::basic_string_view<CharT, Traits>(data(), size());
-  }
 
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  operator ::boost::core::basic_string_view<CharT>() const noexcept
-  {
-    return ::boost::core::basic_string_view<CharT>(data(), size());
-  }
-#endif
-#endif
+      @par Exception Safety
 
-  //--------------------------------------------------------------------------
-  //
-  // Iterators
-  //
-  //--------------------------------------------------------------------------
+      Strong guarantee.
 
-  /// Return an iterator to the beginning.
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  begin() noexcept
-  {
-    return data();
-  }
+      @return `*this`
 
-  /// Return an iterator to the beginning.
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_iterator
-  begin() const noexcept
-  {
-    return data();
-  }
+      @param ch The character to assign to.
 
-  /// Return an iterator to the beginning.
+      @throw std::length_error `count > max_size()`.
+  */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_iterator
-  cbegin() const noexcept
+  basic_static_string&
+  operator=(value_type ch)
   {
-    return data();
+    return assign_char(ch,
+      std::integral_constant<bool, (N > 0)>{});
   }
 
-  /// Return an iterator to the end.
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  end() noexcept
-  {
-    return data() + size();
-  }
+  /** Assign to the string.
 
-  /// Return an iterator to the end.
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_iterator
-  end() const noexcept
-  {
-    return data() + size();
-  }
+      Replaces the contents with those of the
+      initializer list `ilist`.
 
-  /// Return an iterator to the end.
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  const_iterator
-  cend() const noexcept
-  {
-    return data() + size();
-  }
+      @par Complexity
 
-  /// Return a reverse iterator to the beginning.
-  BOOST_STATIC_STRING_CPP17_CONSTEXPR
-  reverse_iterator
-  rbegin() noexcept
-  {
-    return reverse_iterator{end()};
-  }
+      Linear in `init.size()`.
 
-  /// Return a reverse iterator to the beginning.
-  BOOST_STATIC_STRING_CPP17_CONSTEXPR
-  const_reverse_iterator
-  rbegin() const noexcept
-  {
-    return const_reverse_iterator{cend()};
-  }
+      @par Exception Safety
 
-  /// Return a reverse iterator to the beginning.
-  BOOST_STATIC_STRING_CPP17_CONSTEXPR
-  const_reverse_iterator
-  crbegin() const noexcept
-  {
-    return const_reverse_iterator{cend()};
-  }
+      Strong guarantee.
 
-  /// Return a reverse iterator to the end.
-  BOOST_STATIC_STRING_CPP17_CONSTEXPR
-  reverse_iterator
-  rend() noexcept
-  {
-    return reverse_iterator{begin()};
-  }
+      @return `*this`
 
-  /// Return a reverse iterator to the end.
-  BOOST_STATIC_STRING_CPP17_CONSTEXPR
-  const_reverse_iterator
-  rend() const noexcept
-  {
-    return const_reverse_iterator{cbegin()};
-  }
+      @param ilist The initializer list to copy from.
 
-  /// Return a reverse iterator to the end.
-  BOOST_STATIC_STRING_CPP17_CONSTEXPR
-  const_reverse_iterator
-  crend() const noexcept
+      @throw std::length_error `ilist.size() > max_size()`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  operator=(std::initializer_list<value_type> ilist)
   {
-    return const_reverse_iterator{cbegin()};
+    return assign(ilist);
   }
 
-  //--------------------------------------------------------------------------
-  //
-  // Capacity
-  //
-  //--------------------------------------------------------------------------
-
-  /** Return if the string is empty.
+  /** Assign to the string.
 
-      Returns whether the string contains no characters.
+      Replaces the contents with those of
+      `sv`, where `sv` is `string_view_type(t)`.
 
       @par Complexity
 
-      Constant.
+      Linear in `sv.size()`.
 
-      @return `size() == 0`
-  */
-  BOOST_STATIC_STRING_NODISCARD
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  bool
-  empty() const noexcept
-  {
-    return size() == 0;
-  }
+      @par Exception Safety
 
-  /** Return the size of the string.
+      Strong guarantee.
 
-      Returns the number of characters stored in the
-      string, excluding the null terminator.
+      @note
 
-      @par Complexity
+      The view can contain null characters.
 
-      Constant.
-  */
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  size_type
-  size() const noexcept
-  {
-    return this->size_impl();
-  }
+      @tparam T A type convertible to `string_view_type`.
 
-  /** Return the size of the string.
+      @par Constraints
 
-      Returns the number of characters stored in the
-      string, excluding the null terminator.
+      @code
+      std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
-      @par Complexity
+      @return `*this`
 
-      Constant.
+      @param t The object to assign from.
+
+      @throw std::length_error `sv.size() > max_size()`.
   */
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  size_type
-  length() const noexcept
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  operator=(const T& t)
   {
-    return size();
+    return assign(t);
   }
 
-  /** Return the number of characters that can be stored.
+  /** Assign to the string.
 
-      Returns the maximum size of the string, excluding the
-      null terminator. The returned value is always `N`.
+      Replaces the contents with `count` copies of
+      character `ch`.
 
       @par Complexity
 
-      Constant.
-   */
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  size_type
-  max_size() const noexcept
-  {
-    return N;
-  }
+      Linear in `count`.
 
-  /** Increase the capacity.
+      @par Exception Safety
 
-      This function has no effect.
+      Strong guarantee.
 
-      @throw std::length_error `n > max_size()`
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  reserve(size_type n)
-  {
-    if (n > max_size())
-      detail::throw_exception<std::length_error>(
-        "n > max_size()");
-  }
-
-  /** Return the number of characters that can be stored.
-
-      Returns the maximum size of the string, excluding the
-      null terminator. The returned value is always `N`.
-
-      @par Complexity
+      @return `*this`
 
-      Constant.
-   */
-  BOOST_STATIC_STRING_CPP11_CONSTEXPR
-  size_type
-  capacity() const noexcept
-  {
-    return max_size();
-  }
+      @param count The size of the resulting string.
 
-  /** Request the removal of unused capacity.
+      @param ch The value to initialize characters
+      of the string with.
 
-      This function has no effect.
+      @throw std::length_error `count > max_size()`.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  shrink_to_fit() noexcept { }
-
-  //--------------------------------------------------------------------------
-  //
-  // Operations
-  //
-  //--------------------------------------------------------------------------
+  basic_static_string&
+  assign(
+    size_type count,
+    value_type ch);
 
-  /** Clear the contents.
+  /** Assign to the string.
 
-      Erases all characters from the string. After this
-      call, @ref size() returns zero.
+      Replaces the contents with those of
+      the string `s`.
 
       @par Complexity
 
-      Linear in @ref size().
-
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  clear() noexcept
-  {
-    this->set_size(0);
-    term();
-  }
-
-  /** Insert into the string.
-
-      Inserts `count` copies of `ch` at the position `index`.
+      Linear in `s.size()`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam M The size of the other string.
 
       @return `*this`
 
-      @param index The index to insert at.
-      @param count The number of characters to insert.
-      @param ch The character to insert.
+      @param s The string to replace
+      the contents with.
 
-      @throw std::length_error `size() + count > max_size()`
-      @throw std::out_of_range `index > size()`
+      @throw std::length_error `s.size() > max_size()`.
   */
+  template<std::size_t M
+#ifndef BOOST_STATIC_STRING_DOCS
+  , typename std::enable_if<(M < N)>::type* = nullptr
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  insert(
-    size_type index,
-    size_type count,
-    value_type ch)
+  assign(const basic_static_string<M, CharT, Traits, OverflowPolicy>& s)
   {
-    if (index > size())
-      detail::throw_exception<std::out_of_range>(
-        "index > size()");
-    insert(begin() + index, count, ch);
-    return *this;
+    return assign_unchecked(s.data(), s.size());
   }
 
-  /** Insert into the string.
+#ifndef BOOST_STATIC_STRING_DOCS
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  assign(const basic_static_string& s) noexcept
+  {
+    if (data() == s.data())
+      return *this;
+    return assign_unchecked(s.data(), s.size());
+  }
 
-      Inserts the null-terminated character string pointed to by `s`
-      of length `count` at the position `index` where `count`
-      is `traits_type::length(s)`.
+  template<std::size_t M,
+    typename std::enable_if<(M > N)>::type* = nullptr>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  assign(const basic_static_string<M, CharT, Traits, OverflowPolicy>& s)
+  {
+    return assign(s.data(), s.size());
+  }
+#endif
+
+  /** Assign to the string.
+
+      Replaces the contents with those of the string `sub`,
+      where `sub` is `s.substr(pos, count)`.
+
+      @par Complexity
+
+      Linear in `sub.size()`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam M The capacity of the other string.
 
       @return `*this`
 
-      @param index The index to insert at.
-      @param s The string to insert.
+      @param s The string to replace
+      the contents with.
 
-      @throw std::length_error `size() + count > max_size()`
-      @throw std::out_of_range `index > size()`
+      @param pos The index at which to begin the substring.
+
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
+
+      @throw std::length_error `sub.size() > max_size()`.
   */
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  insert(
-    size_type index,
-    const_pointer s)
+  assign(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s,
+    size_type pos,
+    size_type count = npos)
   {
-    return insert(index, s, traits_type::length(s));
+    return assign(s.data() + pos, s.capped_length(pos, count));
   }
 
-  /** Insert into the string.
+  /** Assign to the string.
 
-      Inserts `count` characters of the string pointed to by `s`
-      at the position `index`.
+      Replaces the contents with those of `{s, s + count)`.
+
+      @par Complexity
+
+      Linear in `count`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @note
+
+      The range can contain null characters.
 
       @return `*this`
 
-      @param index The index to insert at.
-      @param s The string to insert.
-      @param count The length of the string to insert.
+      @param count The number of characters to copy.
 
-      @throw std::length_error `size() + count > max_size()`
-      @throw std::out_of_range `index > size()`
-  */
+      @param s A pointer to the string to copy from.
+
+      @throw std::length_error `count > max_size()`.
+    */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  insert(
-    size_type index,
+  assign(
     const_pointer s,
-    size_type count)
-  {
-    if (index > size())
-      detail::throw_exception<std::out_of_range>(
-        "index > size()");
-    insert(data() + index, s, s + count);
-    return *this;
-  }
-
-  /** Insert into the string.
+    size_type count);
 
-      Inserts the string `str`
-      at the position `index`.
+  /** Assign to the string.
 
-      @par Exception Safety
+      Replaces the contents with those of
+      `{s, s + traits_type::length(s))`.
 
-      Strong guarantee.
+      @par Complexity
 
-      @note The insertion is done unchecked when
-      the capacity of `str` differs from that of the
-      string the function is called on.
+      Linear in `count`.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @par Exception Safety
 
-      @tparam M The size of the input string.
+      Strong guarantee.
 
       @return `*this`
 
-      @param index The index to insert at.
-      @param str The string to insert.
+      @param s A pointer to the string to copy from.
 
-      @throw std::length_error `size() + str.size() > max_size()`
-      @throw std::out_of_range `index > size()`
+      @throw std::length_error `traits_type::length(s) > max_size()`.
   */
-  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  insert(
-    size_type index,
-    const basic_static_string<M, CharT, Traits>& str)
+  assign(const_pointer s)
   {
-    return insert_unchecked(index, str.data(), str.size());
+    return assign(s, traits_type::length(s));
   }
 
-#ifndef BOOST_STATIC_STRING_DOCS
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  insert(
-    size_type index,
-    const basic_static_string& str)
-  {
-    return insert(index, str.data(), str.size());
-  }
-#endif
+  /** Assign to the string.
 
-  /** Insert into the string.
+      Replaces the contents with the characters
+      in the range `{first, last)`.
 
-      Inserts a string, obtained by `str.substr(index_str, count)`
-      at the position `index`.
+      @par Complexity
+
+      Linear in `std::distance(first, last)`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note The insertion is done unchecked when
-      the capacity of `str` differs from that of the
-      string the function is called on.
+      @tparam InputIterator The type of the iterators.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @par Constraints
 
-      @tparam M The size of the input string.
+      `InputIterator` satisfies __InputIterator__.
 
       @return `*this`
 
-      @param index The index to insert at.
-      @param str The string from which to insert.
-      @param index_str The index in `str` to start inserting from.
-      @param count The number of characters to insert.
-      The default argument for this parameter is @ref npos.
+      @param first An iterator referring to the
+      first character to assign.
 
-      @throw std::length_error `size() + str.substr(index_str, count).size() > max_size()`
-      @throw std::out_of_range `index > size()`
-      @throw std::out_of_range `index_str > str.size()`
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  insert(
-    size_type index,
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type index_str,
-    size_type count = npos)
-  {
-    return insert_unchecked(index, str.data() + index_str, str.capped_length(index_str, count));
-  }
+      @param last An iterator past the end
+      of the range to assign from.
 
-#ifndef BOOST_STATIC_STRING_DOCS
+      @throw std::length_error `std::distance(first, last) > max_size()`.
+  */
+  template<typename InputIterator>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
+#ifdef BOOST_STATIC_STRING_DOCS
   basic_static_string&
-  insert(
-    size_type index,
-    const basic_static_string& str,
-    size_type index_str,
-    size_type count = npos)
-  {
-    return insert(index, str.data() + index_str, str.capped_length(index_str, count));
-  }
+#else
+  typename std::enable_if<
+    detail::is_input_iterator<InputIterator>::value,
+      basic_static_string&>::type
 #endif
+  assign(
+    InputIterator first,
+    InputIterator last);
 
-  /** Insert into the string.
+  /** Assign to the string.
 
-      Inserts the character `ch` before the character pointed by `pos`.
+      Replaces the contents with those of the
+      initializer list `ilist`.
 
-      @par Precondition
+      @par Complexity
 
-      `pos` shall be vaild within `{data(), data() + size()}`
+      Linear in `init.size()`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
-
-      @return An iterator which refers to the first inserted character
-      or `pos` if no characters were inserted
+      @return `*this`
 
-      @param pos The index to insert at.
-      @param ch The character to insert.
+      @param ilist The initializer list to copy from.
 
-      @throw std::length_error `size() + 1 > max_size()`
+      @throw std::length_error `ilist.size() > max_size()`.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  insert(
-    const_iterator pos,
-    value_type ch)
+  basic_static_string&
+  assign(
+    std::initializer_list<value_type> ilist)
   {
-    return insert(pos, 1, ch);
+    return assign(ilist.begin(), ilist.end());
   }
 
-  /** Insert into the string.
+  /** Assign to the string.
 
-      Inserts `count` copies of `ch` before the character pointed by `pos`.
+      Replaces the contents with those of
+      `sv`, where `sv` is `string_view_type(t)`.
 
-      @par Precondition
+      @par Complexity
 
-      `pos` shall be valid within `{data(), data() + size()}`
+      Linear in `sv.size()`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @note
 
-      @return An iterator which refers to the first inserted character
-      or `pos` if no characters were inserted
+      The view can contain null characters.
 
-      @param pos The position to insert at.
-      @param count The number of characters to insert.
-      @param ch The character to insert.
+      @tparam T A type convertible to `string_view_type`.
 
-      @throw std::length_error `size() + count > max_size()`
+      @par Constraints
+
+      @code
+      std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
+
+      @return `*this`
+
+      @param t The object to assign from.
+
+      @throw std::length_error `sv.size() > max_size()`.
   */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  insert(
-    const_iterator pos,
-    size_type count,
-    value_type ch);
-
-  /** Insert into the string.
+  basic_static_string&
+  assign(const T& t)
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return assign(sv.data(), sv.size());
+  }
 
-      Inserts characters from the range `{first, last)` before the
-      character pointed to by `pos`.
+  /** Assign to the string.
 
-      @par Precondition
+      Replaces the contents with those of the substring `sv`,
+      where `sv` is `string_view_type(t).substr(pos, count)`.
 
-      `pos` shall be valid within `{data(), data() + size()}`,
+      @par Complexity
 
-      `{first, last)` shall be a valid range
+      Linear in `sv.size()`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @note
 
-      @tparam InputIterator The type of the iterators.
+      The view can contain null characters.
+
+      @tparam T A type convertible to `string_view_type`.
 
       @par Constraints
 
-      `InputIterator` satisfies __InputIterator__ and does not
-      satisfy __ForwardIterator__.
+      @code
+      std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
-      @return An iterator which refers to the first inserted character
-      or `pos` if no characters were inserted
+      @return `*this`
 
-      @param pos The position to insert at.
-      @param first An iterator representing the first character to insert.
-      @param last An iterator representing one past the last character to insert.
+      @param t The object to assign from.
 
-      @throw std::length_error `size() + insert_count > max_size()`
-  */
-  template<typename InputIterator>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-#ifdef BOOST_STATIC_STRING_DOCS
-  iterator
-#else
-  typename std::enable_if<
-    detail::is_input_iterator<
-      InputIterator>::value &&
-        !detail::is_forward_iterator<
-          InputIterator>::value, iterator>::type
-#endif
-  insert(
-    const_iterator pos,
-    InputIterator first,
-    InputIterator last);
+      @param pos The index at which to begin the substring.
+
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
 
+      @throw std::length_error `sv.size() > max_size()`.
+  */
+  template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-  template<typename ForwardIterator>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  typename std::enable_if<
-    detail::is_forward_iterator<
-      ForwardIterator>::value,
-        iterator>::type
-  insert(
-    const_iterator pos,
-    ForwardIterator first,
-    ForwardIterator last);
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
+  >
+  basic_static_string&
+  assign(
+    const T& t,
+    size_type pos,
+    size_type count = npos)
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    if( pos > sv.size() )
+      detail::throw_exception<std::out_of_range>(
+          "pos >= t.size()");
+    std::size_t rlen = (std::min)( count, sv.size() - pos );
+    return assign(sv.data() + pos, rlen);
+  }
 
-  /** Insert into the string.
+  //--------------------------------------------------------------------------
+  //
+  // Element access
+  //
+  //--------------------------------------------------------------------------
 
-      Inserts characters from `ilist` before `pos`.
+  /** Access a character with bounds checking.
 
-      @par Precondition
+      Returns a reference to the character at
+      index `pos`.
 
-      `pos` shall be valid within `{data(), data() + size()}`
+      @par Complexity
+
+      Constant.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
-
-      @return An iterator which refers to the first inserted character
-      or `pos` if no characters were inserted
-
-      @param pos The position to insert at.
-      @param ilist The initializer list from which to insert.
+      @param pos The index to access.
 
-      @throw std::length_error `size() + ilist.size() > max_size()`
+      @throw std::out_of_range `pos >= size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  insert(
-    const_iterator pos,
-    std::initializer_list<value_type> ilist)
+  reference
+  at(size_type pos)
   {
-    return insert_unchecked(pos, ilist.begin(), ilist.size());
+    if (pos >= size())
+      detail::throw_exception<std::out_of_range>(
+        "pos >= size()");
+    return data()[pos];
   }
 
-  /** Insert into the string.
+  /** Access a character with bounds checking.
 
-      Constructs a temporary `string_view_type` object `sv` from `t` and
-      inserts `{sv.begin(), sv.end())` at `index`.
+      Returns a reference to the character at
+      index `pos`.
 
-      @par Precondition
+      @par Complexity
 
-      `index` shall be valid within `{data(), data() + size()}`
+      Constant.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @param pos The index to access.
 
-      @return `*this`
+      @throw std::out_of_range `pos >= size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  const_reference
+  at(size_type pos) const
+  {
+    if (pos >= size())
+      detail::throw_exception<std::out_of_range>(
+        "pos >= size()");
+    return data()[pos];
+  }
 
-      @tparam T The type of the object to convert.
+  /** Access a character.
 
-      @par Constraints
+      Returns a reference to the character at
+      index `pos`.
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @par Complexity
 
-      @param index The index to insert at.
-      @param t The string to insert from.
+      Constant.
 
-      @throw std::length_error `size() + sv.size() > max_size()`
-      @throw std::out_of_range `index > size()`
+      @par Precondition
+
+      `pos >= size`
+
+      @param pos The index to access.
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  insert(
-    size_type index,
-    const T& t)
+  reference
+  operator[](size_type pos) noexcept
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return insert(index, sv.data(), sv.size());
+    return data()[pos];
   }
 
-  /** Insert into the string.
-
-      Constructs a temporary `string_view_type` object `sv` from `t`
-      and inserts `sv.substr(index_str, count)` at `index`.
-
-      @par Exception Safety
-
-      Strong guarantee.
-
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+  /** Access a character.
 
-      @tparam T The type of the object to convert.
+      Returns a reference to the character at
+      index `pos`.
 
-      @par Constraints
+      @par Complexity
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const_pointer>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      Constant.
 
-      @return `*this`
+      @par Precondition
 
-      @param index The index to insert at.
-      @param t The string to insert from.
-      @param index_str The index in the temporary `string_view_type` object
-      to start the substring from.
-      @param count The number of characters to insert.
+      `pos >= size`
 
-      @throw std::length_error `size() + sv.size() > max_size()`
-      @throw std::out_of_range `index > size()`
-      @throw std::out_of_range `index_str > sv.size()`
+      @param pos The index to access.
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  insert(
-    size_type index,
-    const T& t,
-    size_type index_str,
-    size_type count = npos)
+  const_reference
+  operator[](size_type pos) const noexcept
   {
-    detail::common_string_view_type<T, CharT, Traits> sv(t);
-    if ( index_str > sv.size() )
-      detail::throw_exception<std::out_of_range>("index_str > t.size()");
-    return insert(index, sv.data() + index_str, (std::min)(sv.size() - index_str, count));
+    return data()[pos];
   }
 
-  /** Erase from the string.
-
-      Erases `num` characters from the string, starting at `index`.
-      `num` is determined as the smaller of `count` and `size() - index`.
-
-      @par Exception Safety
-
-      Strong guarantee.
+  /** Return the first character.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      Returns a reference to the first character.
 
-      @return `*this`
+      @par Complexity
 
-      @param index The index to erase at.
-      The default argument for this parameter is `0`.
+      Constant.
 
-      @param count The number of characters to erase.
-      The default argument for this parameter is @ref npos.
+      @par Precondition
 
-      @throw std::out_of_range `index > size()`
+      `not empty()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  erase(
-    size_type index = 0,
-    size_type count = npos)
+  reference
+  front() noexcept
   {
-    erase(data() + index, data() + index + capped_length(index, count));
-    return *this;
+    return data()[0];
   }
 
-  /** Erase from the string.
-
-      Erases the character at `pos`.
-
-      @par Preconditions
-
-      `pos` shall be valid within `{data(), data() + size()}`
+  /** Return the first character.
 
-      @par Exception Safety
+      Returns a reference to the first character.
 
-      Strong guarantee.
+      @par Complexity
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      Constant.
 
-      @return An iterator referring to character immediately following
-      the erased character, or @ref end() if one does not exist.
+      @par Precondition
 
-      @param pos An iterator referring to the character to erase.
+      `not empty()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  erase(const_iterator pos)
+  const_reference
+  front() const noexcept
   {
-    BOOST_STATIC_STRING_ASSERT(!empty());
-    return erase(pos, pos + 1);
+    return data()[0];
   }
 
-  /** Erase from the string.
-
-      Erases the characters in the range `{first, last)`.
-
-      @par Precondition
-
-      `{first, last}` shall be valid within `{data(), data() + size()}`
-
-      @par Exception Safety
+  /** Return the last character.
 
-      Strong guarantee.
+      Returns a reference to the last character.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @par Complexity
 
-      @return An iterator referring to the character `last`
-      previously referred to, or @ref end() if one does not exist.
+      Constant.
 
-      @param first An iterator referring to the first character to erase.
+      @par Precondition
 
-      @param last An iterator past the last character to erase.
+      `not empty()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  erase(
-    const_iterator first,
-    const_iterator last);
+  reference
+  back() noexcept
+  {
+    return data()[size() - 1];
+  }
 
-  /** Append a character.
+  /** Return the last character.
 
-      Appends a character to the end of the string.
+      Returns a reference to the last character.
 
-      @par Exception Safety
+      @par Complexity
 
-      Strong guarantee.
+      Constant.
 
-      @param ch The character to append.
+      @par Precondition
 
-      @throw std::length_error `size() >= max_size()`
+      `not empty()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  push_back(value_type ch);
+  const_reference
+  back() const noexcept
+  {
+    return data()[size() - 1];
+  }
 
-  /** Remove the last character.
+  /** Return a pointer to the string.
 
-      Removes a character from the end of the string.
+      Returns a pointer to the underlying array
+      serving as storage. The value returned is such that
+      the range `{data(), data() + size())` is always a
+      valid range, even if the container is empty.
 
-      @par Precondition
+      @par Complexity
 
-      `not empty()`
+      Constant.
+
+      @note The value returned from this function
+      is never never a null pointer value.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  pop_back() noexcept
+  pointer
+  data() noexcept
   {
-    BOOST_STATIC_STRING_ASSERT(!empty());
-    this->set_size(size() - 1);
-    term();
+    return this->data_impl();
   }
 
-  /** Append to the string.
-
-      Appends `count` copies of `ch` to the end of the string.
-
-      @par Exception Safety
-
-      Strong guarantee.
+  /** Return a pointer to the string.
 
-      @return `*this`
+      Returns a pointer to the underlying array
+      serving as storage. The value returned is such that
+      the range `{data(), data() + size())` is always a
+      valid range, even if the container is empty.
 
-      @param count The number of characters to append.
+      @par Complexity
 
-      @param ch The character to append.
+      Constant.
 
-      @throw std::length_error `size() + count > max_size()`
+      @note The value returned from this function
+      is never never a null pointer value.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(
-    size_type count,
-    value_type ch);
+  const_pointer
+  data() const noexcept
+  {
+    return this->data_impl();
+  }
 
-  /** Append to the string.
+  /** Return a pointer to the string.
 
-      Appends `s` to the end of the string.
+      Returns a pointer to the underlying array
+      serving as storage. The value returned is such that
+      the range `{c_str(), c_str() + size())` is always a
+      valid range, even if the container is empty.
 
-      @par Exception Safety
+      @par Complexity
 
-      Strong guarantee.
+      Constant.
 
-      @tparam M The size of the string to append.
-
-      @return `*this`
-
-      @param s The string to append.
-
-      @throw std::length_error `size() + s.size() > max_size()`
+      @note The value returned from this function
+      is never never a null pointer value.
   */
-  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(
-    const basic_static_string<M, CharT, Traits>& s)
+  const_pointer
+  c_str() const noexcept
   {
-    return append(s.data(), s.size());
+    return data();
   }
 
-  /** Append to the string.
-
-      Appends the substring `sub` to the end of the string,
-      where `sub` is `s.substr(pos, count)`.
-
-      @par Exception Safety
+#ifdef BOOST_STATIC_STRING_DOCS
+  /** Convert to a string view referring to the string.
 
-      Strong guarantee.
+      Returns a string view referring to the
+      underlying character string.
 
-      @tparam M The size of the string to append.
+      @par Complexity
 
-      @return `*this`
+      Constant.
+  */
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  operator string_view_type() const noexcept
+  {
+    return string_view_type(data(), size());
+  }
+#else
+#ifdef BOOST_STATIC_STRING_HAS_STD_STRING_VIEW
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  operator std::basic_string_view<CharT, Traits>() const noexcept
+  {
+    return std::basic_string_view<CharT, Traits>(data(), size());
+  }
+#endif
+#ifndef BOOST_STATIC_STRING_STANDALONE
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  operator ::boost::basic_string_view<CharT, Traits>() const noexcept
+  {
+    return ::boost::basic_string_view<CharT, Traits>(data(), size());
+  }
 
-      @param s The string to append.
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  operator ::boost::core::basic_string_view<CharT>() const noexcept
+  {
+    return ::boost::core::basic_string_view<CharT>(data(), size());
+  }
+#endif
+#endif
 
-      @param pos The index at which to begin the substring.
+  //--------------------------------------------------------------------------
+  //
+  // Iterators
+  //
+  //--------------------------------------------------------------------------
 
-      @param count The size of the substring. The default
-      argument for this parameter is @ref npos.
+  /// Return an iterator to the beginning.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  iterator
+  begin() noexcept
+  {
+    return data();
+  }
 
-      @throw std::length_error `size() + sub.size() > max_size()`
-      @throw std::out_of_range `pos > s.size()`
-  */
-  template<std::size_t M>
+  /// Return an iterator to the beginning.
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(
-    const basic_static_string<M, CharT, Traits>& s,
-    size_type pos,
-    size_type count = npos)
+  const_iterator
+  begin() const noexcept
   {
-    return append(s.data() + pos, s.capped_length(pos, count));
+    return data();
   }
 
-  /** Append to the string.
+  /// Return an iterator to the beginning.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  const_iterator
+  cbegin() const noexcept
+  {
+    return data();
+  }
 
-      Appends `count` characters from the string pointed
-      to by `s` to the end of the string.
+  /// Return an iterator to the end.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  iterator
+  end() noexcept
+  {
+    return data() + size();
+  }
 
-      @par Exception Safety
+  /// Return an iterator to the end.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  const_iterator
+  end() const noexcept
+  {
+    return data() + size();
+  }
 
-      Strong guarantee.
+  /// Return an iterator to the end.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  const_iterator
+  cend() const noexcept
+  {
+    return data() + size();
+  }
 
-      @note The string can contain null characters.
+  /// Return a reverse iterator to the beginning.
+  BOOST_STATIC_STRING_CPP17_CONSTEXPR
+  reverse_iterator
+  rbegin() noexcept
+  {
+    return reverse_iterator{end()};
+  }
 
-      @return `*this`
+  /// Return a reverse iterator to the beginning.
+  BOOST_STATIC_STRING_CPP17_CONSTEXPR
+  const_reverse_iterator
+  rbegin() const noexcept
+  {
+    return const_reverse_iterator{cend()};
+  }
 
-      @param s The string to append.
+  /// Return a reverse iterator to the beginning.
+  BOOST_STATIC_STRING_CPP17_CONSTEXPR
+  const_reverse_iterator
+  crbegin() const noexcept
+  {
+    return const_reverse_iterator{cend()};
+  }
 
-      @param count The number of characters to append.
+  /// Return a reverse iterator to the end.
+  BOOST_STATIC_STRING_CPP17_CONSTEXPR
+  reverse_iterator
+  rend() noexcept
+  {
+    return reverse_iterator{begin()};
+  }
 
-      @throw std::length_error `size() + count > max_size()`
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(
-    const_pointer s,
-    size_type count);
+  /// Return a reverse iterator to the end.
+  BOOST_STATIC_STRING_CPP17_CONSTEXPR
+  const_reverse_iterator
+  rend() const noexcept
+  {
+    return const_reverse_iterator{cbegin()};
+  }
 
-  /** Append to the string.
+  /// Return a reverse iterator to the end.
+  BOOST_STATIC_STRING_CPP17_CONSTEXPR
+  const_reverse_iterator
+  crend() const noexcept
+  {
+    return const_reverse_iterator{cbegin()};
+  }
 
-      Appends `count` characters from the string pointed
-      to by `s` to the end of the string, where `count`
-      is `traits_type::length(s)`.
+  //--------------------------------------------------------------------------
+  //
+  // Capacity
+  //
+  //--------------------------------------------------------------------------
 
-      @par Exception Safety
+  /** Return if the string is empty.
 
-      Strong guarantee.
+      Returns whether the string contains no characters.
 
-      @return `*this`
+      @par Complexity
 
-      @param s The string to append.
+      Constant.
 
-      @throw std::length_error `size() + count > max_size()`
+      @return `size() == 0`
   */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(const_pointer s)
+  BOOST_STATIC_STRING_NODISCARD
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  bool
+  empty() const noexcept
   {
-    return append(s, traits_type::length(s));
+    return size() == 0;
   }
 
-  // KRYSTIAN TODO: change exception safety
-  /** Append to the string.
+  /** Return the size of the string.
 
-      Appends characters from the range `{first, last)`
-      to the end of the string.
+      Returns the number of characters stored in the
+      string, excluding the null terminator.
 
-      @par Precondition
+      @par Complexity
 
-      `{first, last)` shall be a valid range
+      Constant.
+  */
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  size_type
+  size() const noexcept
+  {
+    return this->size_impl();
+  }
 
-      @par Exception Safety
+  /** Return the size of the string.
 
-      Strong guarantee.
+      Returns the number of characters stored in the
+      string, excluding the null terminator.
 
-      @tparam InputIterator The type of the iterators.
+      @par Complexity
 
-      @par Constraints
+      Constant.
+  */
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  size_type
+  length() const noexcept
+  {
+    return size();
+  }
 
-      `InputIterator` satisfies __InputIterator__.
+  /** Return the number of characters that can be stored.
 
-      @return `*this`
+      Returns the maximum size of the string, excluding the
+      null terminator. The returned value is always `N`.
 
-      @param first An iterator referring to the
-      first character to append.
+      @par Complexity
 
-      @param last An iterator past the end of
-      last character to append.
+      Constant.
+   */
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  size_type
+  max_size() const noexcept
+  {
+    return N;
+  }
 
-      @throw std::length_error `size() + std::distance(first, last) > max_size()`
-  */
-  template<typename InputIterator>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-#ifdef BOOST_STATIC_STRING_DOCS
-  basic_static_string&
-#else
-  typename std::enable_if<
-    detail::is_input_iterator<InputIterator>::value,
-      basic_static_string&>::type
-#endif
-  append(
-    InputIterator first,
-    InputIterator last)
-  {
-    this->set_size(size() + read_back(true, first, last));
-    return term();
-  }
-
-  /** Append to the string.
-
-      Appends the characters from `ilist` to the
-      end of the string.
-
-      @par Exception Safety
-
-      Strong guarantee.
-
-      @return `*this`
+  /** Increase the capacity.
 
-      @param ilist The initializer list to append.
+      This function has no effect.
 
-      @throw std::length_error `size() + ilist.size() > max_size()`
+      @throw std::length_error `n > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(
-    std::initializer_list<value_type> ilist)
+  void
+  reserve(size_type n)
   {
-    return append(ilist.begin(), ilist.size());
+    checked_count(n, max_size(), "n > max_size()");
   }
 
-  /** Append to the string.
-
-      Appends `sv` to the end of the string,
-      where `sv` is `string_view_type(t)`.
-
-      @par Exception Safety
+  /** Return the number of characters that can be stored.
 
-      Strong guarantee.
+      Returns the maximum size of the string, excluding the
+      null terminator. The returned value is always `N`.
 
-      @tparam T The type of the object to convert.
+      @par Complexity
 
-      @par Constraints
+      Constant.
+   */
+  BOOST_STATIC_STRING_CPP11_CONSTEXPR
+  size_type
+  capacity() const noexcept
+  {
+    return max_size();
+  }
 
-      @code
-      std::is_convertible<T const&, string_view>::value &&
-      !std::is_convertible<T const&, char const*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value
-      @endcode
+  /** Return the overflow policy.
 
-      @return `*this`
+      Returns a reference to the overflow policy
+      object of the string, through which a stateful
+      policy such as @ref saturate_on_overflow is
+      queried and reset.
 
-      @param t The string to append.
+      @par Complexity
 
-      @throw std::length_error `size() + sv.size() > max_size()`
+      Constant.
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(const T& t)
+  OverflowPolicy&
+  overflow_policy() noexcept
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return append(sv.data(), sv.size());
+    return *this;
   }
 
-  /** Append to the string.
-
-      Appends the substring `sv` to the end of the string,
-      where `sv` is `string_view_type(t).substr(pos, count)`.
-
-      @par Exception Safety
-
-      Strong guarantee.
-
-      @tparam T The type of the object to convert.
-
-      @par Constraints
-
-      @code
-      std::is_convertible<T const&, string_view>::value &&
-      !std::is_convertible<T const&, char const*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value
-      @endcode
-
-      @return `*this`
-
-      @param t The object to append.
+  /** Return the overflow policy.
 
-      @param pos The index at which to begin the substring.
+      Returns a reference to the overflow policy
+      object of the string, through which a stateful
+      policy such as @ref saturate_on_overflow is
+      queried.
 
-      @param count The size of the substring. The default
-      argument for this parameter is @ref npos.
+      @par Complexity
 
-      @throw std::length_error `size() + sv.size() > max_size()`
+      Constant.
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  append(
-    const T& t,
-    size_type pos,
-    size_type count = npos)
+  constexpr
+  const OverflowPolicy&
+  overflow_policy() const noexcept
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    if ( pos > sv.size() )
-      detail::throw_exception<std::out_of_range>("pos > t.size()");
-    return append(sv.data() + pos, (std::min)(sv.size() - pos, count));
+    return *this;
   }
 
-  /** Append to the string.
+  /** Request the removal of unused capacity.
 
-      Appends `s` to the end of the string.
+      This function has no effect.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  shrink_to_fit() noexcept { }
 
-      @par Exception Safety
+  //--------------------------------------------------------------------------
+  //
+  // Operations
+  //
+  //--------------------------------------------------------------------------
 
-      Strong guarantee.
+  /** Clear the contents.
 
-      @tparam M The size of the string to append.
+      Erases all characters from the string. After this
+      call, @ref size() returns zero.
 
-      @return `*this`
+      @par Complexity
 
-      @param s The string to append.
+      Linear in @ref size().
 
-      @throw std::length_error `size() + s.size() > max_size()`
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
   */
-  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  operator+=(
-    const basic_static_string<M, CharT, Traits>& s)
+  void
+  clear() noexcept
   {
-    return append(s);
+    this->set_size(0);
+    term();
   }
 
-  /** Append to the string.
+  /** Insert into the string.
 
-      Appends a character to the end of the string.
+      Inserts `count` copies of `ch` at the position `index`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @param ch The character to append.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @throw std::length_error `size() >= max_size()`
+      @return `*this`
+
+      @param index The index to insert at.
+      @param count The number of characters to insert.
+      @param ch The character to insert.
+
+      @throw std::length_error `size() + count > max_size()`
+      @throw std::out_of_range `index > size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  operator+=(value_type ch)
+  insert(
+    size_type index,
+    size_type count,
+    value_type ch)
   {
-    push_back(ch);
+    if (index > size())
+      detail::throw_exception<std::out_of_range>(
+        "index > size()");
+    insert(begin() + index, count, ch);
     return *this;
   }
 
-  /** Append to the string.
+  /** Insert into the string.
 
-      Appends `count` characters from the string pointed
-      to by `s` to the end of the string, where `count`
+      Inserts the null-terminated character string pointed to by `s`
+      of length `count` at the position `index` where `count`
       is `traits_type::length(s)`.
 
       @par Exception Safety
 
       Strong guarantee.
 
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
       @return `*this`
 
-      @param s The string to append.
+      @param index The index to insert at.
+      @param s The string to insert.
 
       @throw std::length_error `size() + count > max_size()`
+      @throw std::out_of_range `index > size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  operator+=(const_pointer s)
+  insert(
+    size_type index,
+    const_pointer s)
   {
-    return append(s);
+    return insert(index, s, traits_type::length(s));
   }
 
-  /** Append to the string.
+  /** Insert into the string.
 
-      Appends the characters from `ilist` to the
-      end of the string.
+      Inserts `count` characters of the string pointed to by `s`
+      at the position `index`.
 
       @par Exception Safety
 
       Strong guarantee.
 
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
       @return `*this`
 
-      @param ilist The initializer list to append.
+      @param index The index to insert at.
+      @param s The string to insert.
+      @param count The length of the string to insert.
 
-      @throw std::length_error `size() + ilist.size() > max_size()`
+      @throw std::length_error `size() + count > max_size()`
+      @throw std::out_of_range `index > size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  operator+=(
-    std::initializer_list<value_type> ilist)
+  insert(
+    size_type index,
+    const_pointer s,
+    size_type count)
   {
-    return append(ilist);
+    if (index > size())
+      detail::throw_exception<std::out_of_range>(
+        "index > size()");
+    insert(data() + index, s, s + count);
+    return *this;
   }
 
-  /** Append to the string.
+  /** Insert into the string.
 
-      Appends `sv` to the end of the string,
-      where `sv` is `string_view_type(t)`.
+      Inserts the string `str`
+      at the position `index`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @tparam T The type of the object to convert.
+      @note The insertion is done unchecked when
+      the capacity of `str` differs from that of the
+      string the function is called on.
 
-      @par Constraints
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @code
-      std::is_convertible<T const&, string_view>::value &&
-      !std::is_convertible<T const&, char const*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value
-      @endcode
+      @tparam M The size of the input string.
 
       @return `*this`
 
-      @param t The string to append.
+      @param index The index to insert at.
+      @param str The string to insert.
 
-      @throw std::length_error `size() + sv.size() > max_size()`
+      @throw std::length_error `size() + str.size() > max_size()`
+      @throw std::out_of_range `index > size()`
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  operator+=(const T& t)
+  insert(
+    size_type index,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str)
   {
-    return append(t);
+    return insert_unchecked(index, str.data(), str.size());
   }
 
-  /** Compare a string with the string.
-
-      Let `comp` be `traits_type::compare(data(), s.data(), std::min(size(), s.size())`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `size() == s.size()`, `-1` if `size() < s.size()`, and `1`
-      otherwise.
-
-      @par Complexity
-      Linear.
-
-      @return The result of lexicographically comparing `s` and the string.
-
-      @tparam M The size of the string to compare with.
-
-      @param s The string to compare.
-  */
-  template<std::size_t M>
+#ifndef BOOST_STATIC_STRING_DOCS
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    const basic_static_string<M, CharT, Traits>& s) const noexcept
+  basic_static_string&
+  insert(
+    size_type index,
+    const basic_static_string& str)
   {
-    return detail::lexicographical_compare<CharT, Traits>(
-      data(), size(), s.data(), s.size());
+    return insert(index, str.data(), str.size());
   }
+#endif
 
-  /** Compare a string with the string.
-
-    Let `sub` be `substr(pos1, count1)` and `comp` be
-    `traits_type::compare(sub.data(), s.data(), std::min(sub.size(), s.size())`.
-    If `comp != 0`, then the result is `comp`. Otherwise, the result is
-    `0` if `sub.size() == s.size()`, `-1` if `sub.size() < s.size()`, and `1`
-    otherwise.
-
-    @par Complexity
+  /** Insert into the string.
 
-    Linear.
+      Inserts a string, obtained by `str.substr(index_str, count)`
+      at the position `index`.
 
-    @par Exception Safety
+      @par Exception Safety
 
-    Strong guarantee.
+      Strong guarantee.
 
-    @return The result of lexicographically comparing `sub` and `s`.
+      @note The insertion is done unchecked when
+      the capacity of `str` differs from that of the
+      string the function is called on.
 
-    @tparam M The size of the string to compare with.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-    @param pos1 The index at which to begin the substring.
+      @tparam M The size of the input string.
 
-    @param count1 The size of the substring.
+      @return `*this`
 
-    @param s The string to compare.
+      @param index The index to insert at.
+      @param str The string from which to insert.
+      @param index_str The index in `str` to start inserting from.
+      @param count The number of characters to insert.
+      The default argument for this parameter is @ref npos.
 
-    @throw std::out_of_range `pos1 > size()`
-    */
+      @throw std::length_error `size() + str.substr(index_str, count).size() > max_size()`
+      @throw std::out_of_range `index > size()`
+      @throw std::out_of_range `index_str > str.size()`
+  */
   template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    size_type pos1,
-    size_type count1,
-    const basic_static_string<M, CharT, Traits>& s) const
+  basic_static_string&
+  insert(
+    size_type index,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type index_str,
+    size_type count = npos)
   {
-    return detail::lexicographical_compare<CharT, Traits>(
-      data() + pos1, capped_length(pos1, count1), s.data(), s.size());
+    return insert_unchecked(index, str.data() + index_str, str.capped_length(index_str, count));
   }
 
-  /** Compare a string with the string.
+#ifndef BOOST_STATIC_STRING_DOCS
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  insert(
+    size_type index,
+    const basic_static_string& str,
+    size_type index_str,
+    size_type count = npos)
+  {
+    return insert(index, str.data() + index_str, str.capped_length(index_str, count));
+  }
+#endif
 
-      Let `sub1` be `substr(pos1, count1)`, `sub2` be
-      `s.substr(pos2, count2)`, and `comp` be
-      `traits_type::compare(sub1.data(), sub2.data(), std::min(sub1.size(), sub2.size())`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `sub1.size() == sub2.size()`, `-1` if `sub1.size() < sub2.size()`, and `1`
-      otherwise.
+  /** Insert into the string.
 
-      @par Complexity
+      Inserts the character `ch` before the character pointed by `pos`.
 
-      Linear.
+      @par Precondition
+
+      `pos` shall be vaild within `{data(), data() + size()}`
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @return The result of lexicographically comparing `sub1` and `sub2`.
-
-      @param pos1 The index at which to begin the substring.
-
-      @param count1 The size of the substring.
-
-      @param s The string to compare.
-
-      @param pos2 The index at which to begin the substring to compare.
-
-      @param count2 The size of the substring to compare.
-
-      @throw std::out_of_range `pos1 > size()`
-
-      @throw std::out_of_range `pos2 > s.size()`
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    size_type pos1,
-    size_type count1,
-    const basic_static_string<M, CharT, Traits>& s,
-    size_type pos2,
-    size_type count2 = npos) const
-  {
-    return detail::lexicographical_compare<CharT, Traits>(
-      data() + pos1, capped_length(pos1, count1),
-      s.data() + pos2, s.capped_length(pos2, count2));
-  }
-
-  /** Compare a string with the string.
-
-      Let `len` be `traits_type::length(s)` and `comp` be
-      `traits_type::compare(data(), s, std::min(size(), len)`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `size() == len`, `-1` if `size() < len`, and `1`
-      otherwise.
-
-      @par Complexity
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      Linear.
+      @return An iterator which refers to the first inserted character
+      or `pos` if no characters were inserted
 
-      @return The result of lexicographically comparing `s` and the string.
+      @param pos The index to insert at.
+      @param ch The character to insert.
 
-      @param s The string to compare.
+      @throw std::length_error `size() + 1 > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(const_pointer s) const noexcept
+  iterator
+  insert(
+    const_iterator pos,
+    value_type ch)
   {
-    return detail::lexicographical_compare<CharT, Traits>(
-      data(), size(), s, traits_type::length(s));
+    return insert(pos, 1, ch);
   }
 
-  /** Compare a string with the string.
+  /** Insert into the string.
 
-      Let `sub` be `substr(pos1, count1)`, `len` be
-      `traits_type::length(s)`, and `comp` be
-      `traits_type::compare(sub.data(), s, std::min(size(), len)`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `sub.size() == len`, `-1` if `sub.size() < len`, and `1`
-      otherwise.
+      Inserts `count` copies of `ch` before the character pointed by `pos`.
 
-      @par Complexity
+      @par Precondition
 
-      Linear.
+      `pos` shall be valid within `{data(), data() + size()}`
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @return The result of lexicographically comparing `s` and `sub`.
-
-      @param pos1 The index at which to begin the substring.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @param count1 The size of the substring.
+      @return An iterator which refers to the first inserted character
+      or `pos` if no characters were inserted
 
-      @param s The string to compare.
+      @param pos The position to insert at.
+      @param count The number of characters to insert.
+      @param ch The character to insert.
 
-      @throw std::out_of_range `pos1 > size()`
+      @throw std::length_error `size() + count > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    size_type pos1,
-    size_type count1,
-    const_pointer s) const
-  {
-    return detail::lexicographical_compare<CharT, Traits>(
-      data() + pos1, capped_length(pos1, count1), s, traits_type::length(s));
-  }
+  iterator
+  insert(
+    const_iterator pos,
+    size_type count,
+    value_type ch);
 
-  /** Compare a string with the string.
+  /** Insert into the string.
 
-      Let `sub` be `substr(pos1, count1)`, and `comp` be
-      `traits_type::compare(sub.data(), s, std::min(size(), count2)`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `sub.size() == count2`, `-1` if `sub.size() < count2`, and `1`
-      otherwise.
+      Inserts characters from the range `{first, last)` before the
+      character pointed to by `pos`.
 
-      @par Complexity
+      @par Precondition
 
-      Linear.
+      `pos` shall be valid within `{data(), data() + size()}`,
+
+      `{first, last)` shall be a valid range
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @return The result of lexicographically comparing `s` and `sub`.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @param pos1 The index at which to begin the substring.
+      @tparam InputIterator The type of the iterators.
 
-      @param count1 The size of the substring.
+      @par Constraints
 
-      @param s The string to compare.
+      `InputIterator` satisfies __InputIterator__ and does not
+      satisfy __ForwardIterator__.
 
-      @param count2 The length of the string to compare.
+      @return An iterator which refers to the first inserted character
+      or `pos` if no characters were inserted
 
-      @throw std::out_of_range `pos1 > size()`
+      @param pos The position to insert at.
+      @param first An iterator representing the first character to insert.
+      @param last An iterator representing one past the last character to insert.
+
+      @throw std::length_error `size() + insert_count > max_size()`
   */
+  template<typename InputIterator>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    size_type pos1,
-    size_type count1,
-    const_pointer s,
-    size_type count2) const
-  {
-    return detail::lexicographical_compare<CharT, Traits>(
-      data() + pos1, capped_length(pos1, count1), s, count2);
-  }
+#ifdef BOOST_STATIC_STRING_DOCS
+  iterator
+#else
+  typename std::enable_if<
+    detail::is_input_iterator<
+      InputIterator>::value &&
+        !detail::is_forward_iterator<
+          InputIterator>::value, iterator>::type
+#endif
+  insert(
+    const_iterator pos,
+    InputIterator first,
+    InputIterator last);
 
-  /** Compare a string with the string.
+#ifndef BOOST_STATIC_STRING_DOCS
+  template<typename ForwardIterator>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  typename std::enable_if<
+    detail::is_forward_iterator<
+      ForwardIterator>::value,
+        iterator>::type
+  insert(
+    const_iterator pos,
+    ForwardIterator first,
+    ForwardIterator last);
+#endif
 
-      Let `s` be `string_view_type(t)` and `comp` be
-      `traits_type::compare(data(), s.data(), std::min(size(), s.size())`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `size() == s.size()`, `-1` if `size() < s.size()`, and `1`
-      otherwise.
+  /** Insert into the string.
 
-      @par Complexity
+      Inserts characters from `ilist` before `pos`.
 
-      Linear.
+      @par Precondition
+
+      `pos` shall be valid within `{data(), data() + size()}`
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @tparam T The type of the object to convert.
-
-      @par Constraints
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @code
-      std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const_pointer>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value.
-      @endcode
+      @return An iterator which refers to the first inserted character
+      or `pos` if no characters were inserted
 
-      @return The result of lexicographically comparing `s` and the string.
+      @param pos The position to insert at.
+      @param ilist The initializer list from which to insert.
 
-      @param t The string to compare.
+      @throw std::length_error `size() + ilist.size() > max_size()`
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(const T& t) const noexcept
+  iterator
+  insert(
+    const_iterator pos,
+    std::initializer_list<value_type> ilist)
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return detail::lexicographical_compare<CharT, Traits>(
-      data(), size(), sv.data(), sv.size());
+    return insert_unchecked(pos, ilist.begin(), ilist.size());
   }
 
-  /** Compare a string with the string.
+  /** Insert into the string.
 
-      Let `s` be `string_view_type(t)`, `sub` be
-      `substr(pos1, count1)`, and `comp` be
-      `traits_type::compare(sub.data(), s.data(), std::min(sub.size(), s.size())`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `sub.size() == s.size()`, `-1` if `sub.size() < s.size()`, and `1`
-      otherwise.
+      Constructs a temporary `string_view_type` object `sv` from `t` and
+      inserts `{sv.begin(), sv.end())` at `index`.
 
-      @par Complexity
+      @par Precondition
 
-      Linear.
+      `index` shall be valid within `{data(), data() + size()}`
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @tparam T The type of the object to convert.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @par Constraints
+      @return `*this`
 
-      @code
-      std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const_pointer>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value.
-      @endcode
+      @tparam T The type of the object to convert.
 
-      @return The result of lexicographically comparing `s` and `sub`.
+      @par Constraints
 
-      @param pos1 The index at which to begin the substring.
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
 
-      @param count1 The length of the substring.
+      @param index The index to insert at.
+      @param t The string to insert from.
 
-      @param t The string to compare.
+      @throw std::length_error `size() + sv.size() > max_size()`
+      @throw std::out_of_range `index > size()`
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    size_type pos1,
-    size_type count1,
-    const T& t) const
+  basic_static_string&
+  insert(
+    size_type index,
+    const T& t)
   {
     detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return detail::lexicographical_compare<CharT, Traits>(
-      data() + pos1, capped_length(pos1, count1), sv.data(), sv.size());
+    return insert(index, sv.data(), sv.size());
   }
 
-  /** Compare a string with the string.
-
-      Let `sub1` be `substr(pos1, count1)`, `sub2` be
-      `string_view_type(t).substr(pos2, count2)`, and `comp` be
-      `traits_type::compare(sub1.data(), sub2.data(), std::min(sub1.size(), sub2.size())`.
-      If `comp != 0`, then the result is `comp`. Otherwise, the result is
-      `0` if `sub1.size() == sub2.size()`, `-1` if `sub1.size() < sub2.size()`, and `1`
-      otherwise.
-
-      @par Complexity
+  /** Insert into the string.
 
-      Linear.
+      Constructs a temporary `string_view_type` object `sv` from `t`
+      and inserts `sv.substr(index_str, count)` at `index`.
 
       @par Exception Safety
 
       Strong guarantee.
 
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
       @tparam T The type of the object to convert.
 
       @par Constraints
 
-      @code
-      std::is_convertible<const T&, string_view>::value &&
+      `std::is_convertible<const T&, string_view>::value &&
       !std::is_convertible<const T&, const_pointer>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value.
-      @endcode
-
-      @return The result of lexicographically comparing `sub1` and `sub2`.
-
-      @param pos1 The index at which to begin the substring in the string.
-
-      @param count1 The length of the substring in the string.
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
 
-      @param t The string to compare.
+      @return `*this`
 
-      @param pos2 The index at which to begin the substring in the string view.
+      @param index The index to insert at.
+      @param t The string to insert from.
+      @param index_str The index in the temporary `string_view_type` object
+      to start the substring from.
+      @param count The number of characters to insert.
 
-      @param count2 The length of the substring in the string view.
+      @throw std::length_error `size() + sv.size() > max_size()`
+      @throw std::out_of_range `index > size()`
+      @throw std::out_of_range `index_str > sv.size()`
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  int
-  compare(
-    size_type pos1,
-    size_type count1,
+  basic_static_string&
+  insert(
+    size_type index,
     const T& t,
-    size_type pos2,
-    size_type count2 = npos) const
+    size_type index_str,
+    size_type count = npos)
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    if ( pos2 > sv.size())
-      detail::throw_exception<std::out_of_range>("pos2 > sv.size()");
-    return compare(
-        pos1, count1, sv.data() + pos2,
-        (std::min)(sv.size() - pos2, count2));
+    detail::common_string_view_type<T, CharT, Traits> sv(t);
+    if ( index_str > sv.size() )
+      detail::throw_exception<std::out_of_range>("index_str > t.size()");
+    return insert(index, sv.data() + index_str, (std::min)(sv.size() - index_str, count));
   }
 
-  /** Return a substring.
+  /** Erase from the string.
 
-      Returns a substring of the string.
+      Erases `num` characters from the string, starting at `index`.
+      `num` is determined as the smaller of `count` and `size() - index`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @return A string object containing the characters
-      `{data() + pos, std::min(count, size() - pos))`.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @param pos The index to being the substring at. The
-      default arugment for this parameter is `0`.
-      @param count The length of the substring. The default arugment
-      for this parameter is @ref npos.
+      @return `*this`
 
-      @throw std::out_of_range `pos > size()`
+      @param index The index to erase at.
+      The default argument for this parameter is `0`.
+
+      @param count The number of characters to erase.
+      The default argument for this parameter is @ref npos.
+
+      @throw std::out_of_range `index > size()`
   */
-#ifndef BOOST_STATIC_STRING_GCC5_BAD_CONSTEXPR
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-#endif
-  basic_static_string
-  substr(
-    size_type pos = 0,
-    size_type count = npos) const
+  basic_static_string&
+  erase(
+    size_type index = 0,
+    size_type count = npos)
   {
-    return basic_static_string(
-      data() + pos, capped_length(pos, count));
+    erase(data() + index, data() + index + capped_length(index, count));
+    return *this;
   }
 
-#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
-  /** Return a string view of a substring.
+  /** Erase from the string.
 
-      Returns a view of a substring.
+      Erases the character at `pos`.
+
+      @par Preconditions
+
+      `pos` shall be valid within `{data(), data() + size()}`
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @return A `string_view_type` object referring
-      to `{data() + pos, std::min(count, size() - pos))`.
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
 
-      @param pos The index to being the substring at. The
-      default arugment for this parameter is `0`.
-      @param count The length of the substring. The default arugment
-      for this parameter is @ref npos.
+      @return An iterator referring to character immediately following
+      the erased character, or @ref end() if one does not exist.
 
-      @throw std::out_of_range `pos > size()`
+      @param pos An iterator referring to the character to erase.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  string_view_type
-  subview(
-    size_type pos = 0,
-    size_type count = npos) const
+  iterator
+  erase(const_iterator pos)
   {
-    return string_view_type(
-      data() + pos, capped_length(pos, count));
+    BOOST_STATIC_STRING_ASSERT(!empty());
+    return erase(pos, pos + 1);
   }
-#endif
 
-  /** Copy a substring to another string.
+  /** Erase from the string.
 
-      Copies `std::min(count, size() - pos)` characters starting at
-      index `pos` to the string pointed to by `dest`.
+      Erases the characters in the range `{first, last)`.
 
-      @note The resulting string is not null terminated.
+      @par Precondition
 
-      @return The number of characters copied.
+      `{first, last}` shall be valid within `{data(), data() + size()}`
 
-      @param count The number of characters to copy.
-      @param dest The string to copy to.
-      @param pos The index to begin copying from. The
-      default argument for this parameter is `0`.
+      @par Exception Safety
 
-      @throw std::out_of_range `pos > max_size()`
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return An iterator referring to the character `last`
+      previously referred to, or @ref end() if one does not exist.
+
+      @param first An iterator referring to the first character to erase.
+
+      @param last An iterator past the last character to erase.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  copy(
-    pointer dest,
-    size_type count,
-    size_type pos = 0) const
-  {
-    const auto num_copied = capped_length(pos, count);
-    traits_type::copy(dest, data() + pos, num_copied);
-    return num_copied;
-  }
+  iterator
+  erase(
+    const_iterator first,
+    const_iterator last);
 
-  /** Change the size of the string.
+  /** Append a character.
 
-      Resizes the string to contain `n` characters. If
-      `n > size()`, characters with the value `CharT()` are
-      appended. Otherwise, `size()` is reduced to `n`.
+      Appends a character to the end of the string.
 
-      @param n The size to resize the string to.
+      @par Exception Safety
 
-      @throw std::out_of_range `n > max_size()`
+      Strong guarantee.
+
+      @param ch The character to append.
+
+      @throw std::length_error `size() >= max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   void
-  resize(size_type n)
-  {
-    resize(n, value_type());
-  }
+  push_back(value_type ch);
 
-  /** Change the size of the string.
+  /** Remove the last character.
 
-      Resizes the string to contain `n` characters. If
-      `n > size()`, copies of `c` are
-      appended. Otherwise, `size()` is reduced to `n`.
+      Removes a character from the end of the string.
 
-      @param n The size to resize the string to.
-      @param c The characters to append if the size
-      increases.
+      @par Precondition
 
-      @throw std::out_of_range `n > max_size()`
+      `not empty()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   void
-  resize(
-    size_type n,
-    value_type c);
+  pop_back() noexcept
+  {
+    BOOST_STATIC_STRING_ASSERT(!empty());
+    this->set_size(size() - 1);
+    term();
+  }
 
-  /** Swap two strings.
+  /** Append to the string.
 
-      Swaps the contents of the string and `s`.
+      Appends `count` copies of `ch` to the end of the string.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note
+      @return `*this`
 
-      All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @param count The number of characters to append.
 
-      @param s The string to swap with.
+      @param ch The character to append.
+
+      @throw std::length_error `size() + count > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  swap(basic_static_string& s) noexcept;
+  basic_static_string&
+  append(
+    size_type count,
+    value_type ch);
 
-  /** Swap two strings.
+  /** Append to the string.
 
-      Swaps the contents of the string and `s`.
+      Appends `s` to the end of the string.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note
-
-      All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam M The size of the string to append.
 
-      @tparam M The size of the string to swap with.
+      @return `*this`
 
-      @param s The string to swap with.
+      @param s The string to append.
 
-      @throw std::length_error `s.size() > max_size() || size() > s.max_size()`
+      @throw std::length_error `size() + s.size() > max_size()`
   */
   template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  void
-  swap(basic_static_string<M, CharT, Traits>& s);
+  basic_static_string&
+  append(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s)
+  {
+    return append(s.data(), s.size());
+  }
 
-  /** Replace a part of the string.
+  /** Append to the string.
 
-      Replaces `rcount` characters starting at index `pos1` with those
-      of `str`, where `rcount` is `std::min(n1, size() - pos1)`.
+      Appends the substring `sub` to the end of the string,
+      where `sub` is `s.substr(pos, count)`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note The replacement is done unchecked when
-      the capacity of `str` differs from that of the
-      string the function is called on.
+      @tparam M The size of the string to append.
 
-      All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @return `*this`
 
-      @tparam M The size of the input string.
+      @param s The string to append.
 
-      @return `*this`
+      @param pos The index at which to begin the substring.
 
-      @param pos1 The index to replace at.
-      @param n1 The number of characters to replace.
-      @param str The string to replace with.
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
 
-      @throw std::length_error `size() + (str.size() - rcount) > max_size()`
-      @throw std::out_of_range `pos1 > size()`
+      @throw std::length_error `size() + sub.size() > max_size()`
+      @throw std::out_of_range `pos > s.size()`
   */
-  template<size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    size_type pos1,
-    size_type n1,
-    const basic_static_string<M, CharT, Traits>& str)
-  {
-    return replace_unchecked(pos1, n1, str.data(), str.size());
-  }
-
-#ifndef BOOST_STATIC_STRING_DOCS
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  replace(
-    size_type pos1,
-    size_type n1,
-    const basic_static_string& str)
+  append(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s,
+    size_type pos,
+    size_type count = npos)
   {
-    return replace(pos1, n1, str.data(), str.size());
+    return append(s.data() + pos, s.capped_length(pos, count));
   }
-#endif
 
-  /** Replace a part of the string.
+  /** Append to the string.
 
-      Replaces `rcount` characters starting at index `pos1` with those of
-      `str.subview(pos2, n2)`, where `rcount` is `std::min(n1, size() - pos1)`.
+      Appends `count` characters from the string pointed
+      to by `s` to the end of the string.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note The replacement is done unchecked when
-      the capacity of `str` differs from that of the
-      string the function is called on.
-
-      All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @note The string can contain null characters.
 
       @return `*this`
 
-      @param pos1 The index to replace at.
-      @param n1 The number of characters to replace.
-      @param str The string to replace with.
-      @param pos2 The index to begin the substring.
-      @param n2 The length of the substring.
-      The default argument for this parameter is @ref npos.
+      @param s The string to append.
 
-      @throw std::length_error `size() + (std::min(str.size(), n2) - rcount) > max_size()`
-      @throw std::out_of_range `pos1 > size()`
-      @throw std::out_of_range `pos2 > str.size()`
+      @param count The number of characters to append.
+
+      @throw std::length_error `size() + count > max_size()`
   */
-  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  replace(
-    size_type pos1,
-    size_type n1,
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos2,
-    size_type n2 = npos)
-  {
-    return replace_unchecked(pos1, n1, str.data() + pos2, str.capped_length(pos2, n2));
-  }
+  append(
+    const_pointer s,
+    size_type count);
 
-#ifndef BOOST_STATIC_STRING_DOCS
+  /** Append to the string.
+
+      Appends `count` characters from the string pointed
+      to by `s` to the end of the string, where `count`
+      is `traits_type::length(s)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @return `*this`
+
+      @param s The string to append.
+
+      @throw std::length_error `size() + count > max_size()`
+  */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  replace(
-    size_type pos1,
-    size_type n1,
-    const basic_static_string& str,
-    size_type pos2,
-    size_type n2 = npos)
+  append(const_pointer s)
   {
-    return replace(pos1, n1, str.data() + pos2, str.capped_length(pos2, n2));
+    return append(s, traits_type::length(s));
   }
-#endif
 
-  /** Replace a part of the string.
+  // KRYSTIAN TODO: change exception safety
+  /** Append to the string.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and
-      replaces `rcount` characters starting at index `pos1` with those
-      of `sv`, where `rcount` is `std::min(n1, size() - pos1)`.
+      Appends characters from the range `{first, last)`
+      to the end of the string.
+
+      @par Precondition
+
+      `{first, last)` shall be a valid range
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
-
-      @tparam T The type of the object to convert.
+      @tparam InputIterator The type of the iterators.
 
       @par Constraints
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      `InputIterator` satisfies __InputIterator__.
 
       @return `*this`
 
-      @param pos1 The index to replace at.
-      @param n1 The number of characters to replace.
-      @param t The object to replace with.
+      @param first An iterator referring to the
+      first character to append.
 
-      @throw std::length_error `size() + (sv.size() - rcount) > max_size()`
-      @throw std::out_of_range `pos1 > size()`
+      @param last An iterator past the end of
+      last character to append.
+
+      @throw std::length_error `size() + std::distance(first, last) > max_size()`
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
+  template<typename InputIterator>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
+#ifdef BOOST_STATIC_STRING_DOCS
   basic_static_string&
-  replace(
-    size_type pos1,
-    size_type n1,
-    const T& t)
+#else
+  typename std::enable_if<
+    detail::is_input_iterator<InputIterator>::value,
+      basic_static_string&>::type
+#endif
+  append(
+    InputIterator first,
+    InputIterator last)
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return replace(pos1, n1, sv.data(), sv.size());
+    this->set_size(size() + read_back(true, first, last));
+    return term();
   }
 
-  /** Replace a part of the string.
+  /** Append to the string.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and
-      replaces `rcount` characters starting at index `pos1` with those
-      of `sv.substr(pos2, n2)`, where `rcount` is `std::min(n1, size() - pos)`.
+      Appends the characters from `ilist` to the
+      end of the string.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @return `*this`
+
+      @param ilist The initializer list to append.
+
+      @throw std::length_error `size() + ilist.size() > max_size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  append(
+    std::initializer_list<value_type> ilist)
+  {
+    return append(ilist.begin(), ilist.size());
+  }
+
+  /** Append to the string.
+
+      Appends `sv` to the end of the string,
+      where `sv` is `string_view_type(t)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
 
       @tparam T The type of the object to convert.
 
       @par Constraints
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
       @return `*this`
 
-      @param pos1 The index to replace at.
-      @param n1 The number of characters to replace.
-      @param t The object to replace with.
-      @param pos2 The index to begin the substring.
-      @param n2 The length of the substring.
-      The default argument for this parameter is @ref npos.
+      @param t The string to append.
 
-      @throw std::length_error `size() + (std::min(n2, sv.size()) - rcount) > max_size()`
-      @throw std::out_of_range `pos1 > size()`
-      @throw std::out_of_range `pos2 > sv.size()`
+      @throw std::length_error `size() + sv.size() > max_size()`
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  replace(
-    size_type pos1,
-    size_type n1,
-    const T& t,
-    size_type pos2,
-    size_type n2 = npos)
+  append(const T& t)
   {
     detail::common_string_view_type<T, CharT, Traits> sv = t;
-    if ( pos2 > sv.size())
-      detail::throw_exception<std::out_of_range>("pos2 > t.size()");
-    return replace(
-        pos1, n1, sv.data() + pos2,
-        (std::min)(sv.size() - pos2, n2));
+    return append(sv.data(), sv.size());
   }
 
-  /** Replace a part of the string.
+  /** Append to the string.
 
-      Replaces `rcount` characters starting at index `pos` with those of
-      `{s, s + n2)`, where `rcount` is `std::min(n1, size() - pos)`.
+      Appends the substring `sv` to the end of the string,
+      where `sv` is `string_view_type(t).substr(pos, count)`.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
       @return `*this`
 
-      @param pos The index to replace at.
-      @param n1 The number of characters to replace.
-      @param s The string to replace with.
-      @param n2 The length of the string to replace with.
+      @param t The object to append.
 
-      @throw std::length_error `size() + (n2 - rcount) > max_size()`
-      @throw std::out_of_range `pos > size()`
+      @param pos The index at which to begin the substring.
+
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
+
+      @throw std::length_error `size() + sv.size() > max_size()`
   */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  replace(
+  append(
+    const T& t,
     size_type pos,
-    size_type n1,
-    const_pointer s,
-    size_type n2)
+    size_type count = npos)
   {
-    return replace(data() + pos, data() + pos + capped_length(pos, n1), s, n2);
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    if ( pos > sv.size() )
+      detail::throw_exception<std::out_of_range>("pos > t.size()");
+    return append(sv.data() + pos, (std::min)(sv.size() - pos, count));
   }
 
-  /** Replace a part of the string.
+  /** Append a number to the string.
 
-      Replaces `rcount` characters starting at index `pos` with those of
-      `{s, s + len)`, where the length of the string `len` is `traits_type::length(s)` and `rcount`
-      is `std::min(n1, size() - pos)`.
+      Appends the digits of `value` in `base`, preceded
+      by a minus sign if `value` is negative, as
+      @ref to_static_string does. The digits are written
+      directly to the end of the string.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam Integer The type of the number.
+
+      @par Constraints
+
+      `std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value`
 
       @return `*this`
 
-      @param pos The index to replace at.
-      @param n1 The number of characters to replace.
-      @param s The string to replace with.
+      @param value The number to append.
 
-      @throw std::length_error `size() + (len - rcount) > max_size()`
-      @throw std::out_of_range `pos > size()`
+      @param base The base, in the range `[2, 36]`.
+
+      @throw std::invalid_argument if `base` is not in the range `[2, 36]`
+
+      @throw std::length_error if the number does not fit
   */
+  template<typename Integer
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = typename std::enable_if<
+        std::is_integral<Integer>::value &&
+        !std::is_same<Integer, bool>::value>::type
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
   basic_static_string&
-  replace(
-    size_type pos,
-    size_type n1,
-    const_pointer s)
-  {
-    return replace(pos, n1, s, traits_type::length(s));
+  append_number(
+    Integer value,
+    int base = 10)
+  {
+    using unsigned_type = typename std::make_unsigned<Integer>::type;
+    if (base < 2 || base > 36)
+      detail::throw_exception<std::invalid_argument>(
+        "base < 2 || base > 36");
+    const bool negative =
+      detail::is_negative(value, std::is_signed<Integer>{});
+    // negating in the unsigned type is also
+    // correct for the minimum value
+    const auto digits = negative ?
+      static_cast<unsigned_type>(0u - static_cast<unsigned_type>(value)) :
+      static_cast<unsigned_type>(value);
+    const auto curr_size = size();
+    const size_type count = negative +
+      detail::count_digits(digits, unsigned(base));
+    // a number is appended whole or not at all
+    if (checked_count(count, max_size() - curr_size,
+        "count > max_size() - size()") != count)
+      return *this;
+    pointer first = detail::unsigned_to_string(
+      end() + count, digits, unsigned(base));
+    if (negative)
+      traits_type::assign(*--first, value_type('-'));
+    this->set_size(curr_size + count);
+    return term();
   }
 
-  /** Replace a part of the string.
+  /** Append a floating point number to the string.
 
-      Replaces `rcount` characters starting at index `pos` with `n2` copies
-      of `c`, where `rcount` is `std::min(n1, size() - pos)`.
+      Appends the shortest string that converts back to
+      `value`, as @ref to_static_string does. The characters
+      are written directly to the end of the string when
+      there is room for the longest possible result.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam Float The type of the number.
+
+      @par Constraints
+
+      `std::is_same<Float, float>::value || std::is_same<Float, double>::value`
 
       @return `*this`
 
-      @param pos The index to replace at.
-      @param n1 The number of characters to replace.
-      @param n2 The number of characters to replace with.
-      @param c The character to replace with.
+      @param value The number to append.
 
-      @throw std::length_error `size() + (n2 - rcount) > max_size()`
-      @throw std::out_of_range `pos > size()`
+      @throw std::length_error if the number does not fit
   */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  template<typename Float
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = typename std::enable_if<
+        std::is_same<Float, float>::value ||
+        std::is_same<Float, double>::value>::type
+#endif
+  >
   basic_static_string&
-  replace(
-    size_type pos,
-    size_type n1,
-    size_type n2,
-    value_type c)
+  append_float(Float value)
   {
-    return replace(data() + pos, data() + pos + capped_length(pos, n1), n2, c);
+    return append_float_impl(value);
   }
 
-  /** Replace a part of the string.
-
-      Replaces the characters in the range `{i1, i2)`
-      with those of `str`.
-
-      @par Precondition
+  /** Append a floating point number to the string.
 
-      `{i1, i2)` is a valid range.
+      Appends `value` formatted like `std::printf` with
+      `"%.*g"`, without the trailing zeros of the fraction,
+      as @ref to_static_string does. The characters are
+      written directly to the end of the string when there
+      is room for the longest possible result.
 
       @par Exception Safety
 
       Strong guarantee.
 
-      @note The replacement is done unchecked when
-      the capacity of `str` differs from that of the
-      string the function is called on.
+      @tparam Float The type of the number.
 
-      All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @par Constraints
 
-      @tparam M The size of the input string.
+      `std::is_same<Float, float>::value || std::is_same<Float, double>::value`
 
       @return `*this`
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator referring past the end of
-      the last character to replace.
-      @param str The string to replace with.
+      @param value The number to append.
 
-      @throw std::length_error `size() + (str.size() - std::distance(i1, i2)) > max_size()`
-  */
-  template<std::size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    const basic_static_string<M, CharT, Traits>& str)
-  {
-    return replace_unchecked(i1, i2, str.data(), str.size());
-  }
+      @param precision The number of significant digits,
+      which is clamped to `[1, max_digits10]`.
 
+      @throw std::length_error if the number does not fit
+  */
+  template<typename Float
 #ifndef BOOST_STATIC_STRING_DOCS
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    , typename = typename std::enable_if<
+        std::is_same<Float, float>::value ||
+        std::is_same<Float, double>::value>::type
+#endif
+  >
   basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    const basic_static_string& str)
+  append_float(
+    Float value,
+    int precision)
   {
-    return replace(i1, i2, str.data(), str.size());
+    return append_float_impl(value, precision);
   }
-#endif
-
-  /** Replace a part of the string.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and
-      replaces the characters in the range `{i1, i2)` with those
-      of `sv`.
-
-      @par Precondition
+  /** Append a character to the string, if it fits.
 
-      `{i1, i2)` is a valid range.
+      Appends `ch` if the string is not full. Unlike
+      @ref push_back, this function never throws and
+      does not invoke the overflow policy.
 
       @par Exception Safety
 
-      Strong guarantee.
+      No-throw guarantee. The string is unchanged
+      if the character does not fit.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @return `true` if the character was appended.
 
-      @tparam T The type of the object to convert.
+      @param ch The character to append.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  try_push_back(value_type ch) noexcept
+  {
+    const auto curr_size = size();
+    if (curr_size >= max_size())
+      return false;
+    traits_type::assign(data()[curr_size], ch);
+    this->set_size(curr_size + 1);
+    term();
+    return true;
+  }
 
-      @par Constraints
+  /** Append characters to the string, if they fit.
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      Appends `count` copies of `ch` if the result fits
+      in the string. Unlike @ref append, this function
+      never throws and does not invoke the overflow policy.
 
-      @return `*this`
+      @par Exception Safety
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator referring past the end of
-      the last character to replace.
-      @param t The object to replace with.
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      @throw std::length_error `size() + (sv.size() - std::distance(i1, i2)) > max_size()`
+      @return `true` if the characters were appended.
+
+      @param count The number of characters to append.
+      @param ch The character to append.
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    const T& t)
+  bool
+  try_append(
+    size_type count,
+    value_type ch) noexcept
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return replace(i1, i2, sv.data(), sv.data() + sv.size());
+    const auto curr_size = size();
+    if (count > max_size() - curr_size)
+      return false;
+    traits_type::assign(end(), count, ch);
+    this->set_size(curr_size + count);
+    term();
+    return true;
   }
 
-  /** Replace a part of the string.
-
-      Replaces the characters in the range `{i1, i2)` with those of
-      `{s, s + n)`.
-
-      @par Precondition
+  /** Append to the string, if it fits.
 
-      `{i1, i2)` is a valid range.
+      Appends the characters in the range `{s, s + count)`
+      if the result fits in the string. Unlike @ref append,
+      this function never throws and does not invoke the
+      overflow policy.
 
       @par Exception Safety
 
-      Strong guarantee.
-
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
-
-      @return `*this`
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator referring past the end of
-      the last character to replace.
-      @param s The string to replace with.
-      @param n The length of the string to replace with.
+      @return `true` if the characters were appended.
 
-      @throw std::length_error `size() + (n - std::distance(i1, i2)) > max_size()`
+      @param s The string to append.
+      @param count The length of the string to append.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
+  bool
+  try_append(
     const_pointer s,
-    size_type n)
+    size_type count) noexcept
   {
-    return replace(i1, i2, s, s + n);
+    const auto curr_size = size();
+    if (count > max_size() - curr_size)
+      return false;
+    traits_type::copy(end(), s, count);
+    this->set_size(curr_size + count);
+    term();
+    return true;
   }
 
-  /** Replace a part of the string.
-
-      Replaces the characters in the range `{i1, i2)` with those of
-      `{s, s + len)`, where the length of the string `len` is `traits_type::length(s)`.
-
-      @par Precondition
+  /** Append to the string, if it fits.
 
-      `{i1, i2)` shall be a valid range.
+      Appends the characters in the range
+      `{s, s + traits_type::length(s))` if the result fits
+      in the string.
 
       @par Exception Safety
 
-      Strong guarantee.
-
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
-
-      @return `*this`
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator referring past the end of
-      the last character to replace.
-      @param s The string to replace with.
+      @return `true` if the characters were appended.
 
-      @throw std::length_error `size() + (len - std::distance(i1, i2)) > max_size()`
+      @param s The string to append.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    const_pointer s)
+  bool
+  try_append(const_pointer s) noexcept
   {
-    return replace(i1, i2, s, traits_type::length(s));
+    return try_append(s, traits_type::length(s));
   }
 
-  /** Replace a part of the string.
-
-      Replaces the characters in the range `{i1, i2)` with
-      `n` copies of `c`.
-
-      @par Precondition
+  /** Append to the string, if it fits.
 
-      `{i1, i2)` is a valid range.
+      Appends `sv`, where `sv` is `string_view_type(t)`,
+      if the result fits in the string.
 
       @par Exception Safety
 
-      Strong guarantee.
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      @tparam T The type of the object to convert.
 
-      @return `*this`
+      @par Constraints
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator past the end of
-      the last character to replace.
-      @param n The number of characters to replace with.
-      @param c The character to replace with.
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
-      @throw std::length_error `size() + (n - std::distance(i1, i2)) > max_size()`
+      @return `true` if the characters were appended.
+
+      @param t The string to append.
   */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    size_type n,
-    value_type c);
+  bool
+  try_append(const T& t) noexcept
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return try_append(sv.data(), sv.size());
+  }
 
-  /** Replace a part of the string.
+  /** Append to the string, if it fits.
 
-      Replaces the characters in the range `{i1, i2)`
-      with those of `{j1, j2)`.
+      Appends `s` if the result fits in the string.
+      The string `s` may be `*this`, and may have a
+      different overflow policy.
 
-      @par Precondition
+      @par Exception Safety
 
-      `{i1, i2)` is a valid range.
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      `{j1, j2)` is a valid range.
+      @tparam M The size of the string to append.
 
-      @par Exception Safety
+      @return `true` if the characters were appended.
 
-      Strong guarantee.
+      @param s The string to append.
+  */
+  template<std::size_t M, typename OtherPolicy>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  try_append(
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s) noexcept
+  {
+    return try_append(s.data(), s.size());
+  }
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+  /** Append to the string, if it fits.
 
-      @tparam InputIterator The type of the iterators.
+      Appends `sub`, where `sub` is `s.substr(pos, count)`,
+      if `pos <= s.size()` and the result fits in the string.
 
-      @par Constraints
+      @par Exception Safety
 
-      `InputIterator` satisfies __InputIterator__ and does not
-      satisfy __ForwardIterator__.
+      No-throw guarantee. The string is unchanged
+      if the characters are not appended.
 
-      @return `*this`
+      @tparam M The size of the string to append.
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator referring past the end of
-      the last character to replace.
-      @param j1 An iterator referring to the first character to replace with.
-      @param j2 An iterator referring past the end of
-      the last character to replace with.
+      @return `true` if the characters were appended.
 
-      @throw std::length_error `size() + (inserted - std::distance(i1, i2)) > max_size()`
+      @param s The string to append.
+      @param pos The index at which to begin the substring.
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
   */
-  template<typename InputIterator>
+  template<std::size_t M, typename OtherPolicy>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-#ifdef BOOST_STATIC_STRING_DOCS
-  basic_static_string&
-#else
-  typename std::enable_if<
-    detail::is_input_iterator<
-      InputIterator>::value &&
-        !detail::is_forward_iterator<
-          InputIterator>::value,
-            basic_static_string<N, CharT, Traits>&>::type
-#endif
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    InputIterator j1,
-    InputIterator j2);
+  bool
+  try_append(
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s,
+    size_type pos,
+    size_type count = npos) noexcept
+  {
+    if (pos > s.size())
+      return false;
+    return try_append(s.data() + pos, (std::min)(count, s.size() - pos));
+  }
 
-#ifndef BOOST_STATIC_STRING_DOCS
-  template<typename ForwardIterator>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  typename std::enable_if<
-    detail::is_forward_iterator<
-      ForwardIterator>::value,
-        basic_static_string<N, CharT, Traits>&>::type
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    ForwardIterator j1,
-    ForwardIterator j2);
-#endif
+  /** Assign to the string, if it fits.
 
-  /** Replace a part of the string.
+      Replaces the contents with `count` copies of `ch`
+      if `count <= max_size()`. Unlike @ref assign, this
+      function never throws and does not invoke the
+      overflow policy.
 
-      Replaces the characters in the range `{i1, i2)`
-      with those of contained in the initializer list `il`.
+      @par Exception Safety
 
-      @par Precondition
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      `{i1, i2)` is a valid range.
+      @return `true` if the string was assigned.
 
-      @par Exception Safety
+      @param count The size of the resulting string.
+      @param ch The value to initialize characters of the string with.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  try_assign(
+    size_type count,
+    value_type ch) noexcept
+  {
+    if (count > max_size())
+      return false;
+    this->set_size(count);
+    traits_type::assign(data(), count, ch);
+    term();
+    return true;
+  }
 
-      Strong guarantee.
+  /** Assign to the string, if it fits.
 
-      @note All references, pointers, or iterators
-      referring to contained elements are invalidated. Any
-      past-the-end iterators are also invalidated.
+      Replaces the contents with those of `{s, s + count)`
+      if `count <= max_size()`. Unlike @ref assign, this
+      function never throws and does not invoke the
+      overflow policy.
 
-      @return `*this`
+      @par Exception Safety
 
-      @param i1 An iterator referring to the first character to replace.
-      @param i2 An iterator past the end of
-      the last character to replace.
-      @param il The initializer list to replace with.
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      @throw std::length_error `size() + (il.size() - std::distance(i1, i2)) > max_size()`
+      @return `true` if the string was assigned.
+
+      @param s A pointer to the string to copy from.
+      @param count The number of characters to copy.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace(
-    const_iterator i1,
-    const_iterator i2,
-    std::initializer_list<value_type> il)
+  bool
+  try_assign(
+    const_pointer s,
+    size_type count) noexcept
   {
-    return replace_unchecked(i1, i2, il.begin(), il.size());
+    if (count > max_size())
+      return false;
+    this->set_size(count);
+    traits_type::move(data(), s, count);
+    term();
+    return true;
   }
 
-  //--------------------------------------------------------------------------
-  //
-  // Search
-  //
-  //--------------------------------------------------------------------------
+  /** Assign to the string, if it fits.
 
-  /** Find the first occurrence of a string within the string.
+      Replaces the contents with those of
+      `{s, s + traits_type::length(s))` if the
+      result fits in the string.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
-      the first occurrence of `sv` within the string starting at the index `pos`.
+      @par Exception Safety
 
-      @par Complexity
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      Linear.
+      @return `true` if the string was assigned.
 
-      @note An empty string is always found.
+      @param s A pointer to the string to copy from.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  try_assign(const_pointer s) noexcept
+  {
+    return try_assign(s, traits_type::length(s));
+  }
+
+  /** Assign to the string, if it fits.
+
+      Replaces the contents with those of `sv`, where
+      `sv` is `string_view_type(t)`, if the result fits
+      in the string.
+
+      @par Exception Safety
+
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
       @tparam T The type of the object to convert.
 
       @par Constraints
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
-      @return The lowest index `idx` greater than or equal to `pos`
-      where each element of `{sv.begin(), sv.end())` is equal to
-      that of `{begin() + idx, begin() + idx + count)` if one exists,
-      and @ref npos otherwise.
+      @return `true` if the string was assigned.
 
-      @param t The string to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      @param t The object to assign from.
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find(
-    const T& t,
-    size_type pos = 0) const
-#ifdef BOOST_STATIC_STRING_DOCS
-      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
-#else
-      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
-#endif
+  bool
+  try_assign(const T& t) noexcept
   {
     detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return find(sv.data(), pos, sv.size());
+    return try_assign(sv.data(), sv.size());
   }
 
-    /** Find the first occurrence of a string within the string.
+  /** Assign to the string, if it fits.
 
-      Finds the first occurrence of `str` within the
-      string starting at the index `pos`.
+      Replaces the contents with those of `s` if the
+      result fits in the string. The string `s` may
+      have a different overflow policy, which is not
+      assigned.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters do not fit.
 
-      @return The lowest index `idx` greater than or equal to `pos`
-      where each element of `str` is equal to that of
-      `{begin() + idx, begin() + idx + str.size())`
-      if one exists, and @ref npos otherwise.
+      @tparam M The size of the string to assign from.
 
-      @param str The string to search for.
-      @param pos The index to start searching at. The default argument for
-      this parameter is `0`.
+      @return `true` if the string was assigned.
+
+      @param s The string to assign from.
   */
-  template<std::size_t M>
+  template<std::size_t M, typename OtherPolicy>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find(
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos = 0) const noexcept
+  bool
+  try_assign(
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s) noexcept
   {
-    return find(str.data(), pos, str.size());
+    return try_assign(s.data(), s.size());
   }
 
-  /** Find the first occurrence of a string within the string.
+  /** Assign to the string, if it fits.
 
-      Finds the first occurrence of the string pointed to
-      by `s` within the string starting at the index `pos`.
+      Replaces the contents with those of `sub`, where
+      `sub` is `s.substr(pos, count)`, if `pos <= s.size()`
+      and the result fits in the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the string is not assigned.
 
-      @note An empty string is always found.
+      @tparam M The size of the string to assign from.
 
-      @return The lowest index `idx` greater than or equal to `pos`
-      where each element of `{s, s + n)` is equal to that of
-      `{begin() + idx, begin() + idx + n)` if one exists,
-      and @ref npos otherwise.
+      @return `true` if the string was assigned.
 
-      @param s The string to search for.
-      @param pos The index to start searching at.
-      @param n The length of the string to search for.
+      @param s The string to assign from.
+      @param pos The index at which to begin the substring.
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
   */
+  template<std::size_t M, typename OtherPolicy>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find(
-    const_pointer s,
+  bool
+  try_assign(
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s,
     size_type pos,
-    size_type n) const noexcept;
-
-  /** Find the first occurrence of a string within the string.
+    size_type count = npos) noexcept
+  {
+    if (pos > s.size())
+      return false;
+    return try_assign(s.data() + pos, (std::min)(count, s.size() - pos));
+  }
 
-      Finds the first occurrence of the string pointed to by `s`
-      of length `count` within the string starting at the index `pos`,
-      where `count` is `traits_type::length(s)`.
+  /** Insert characters into the string, if they fit.
 
-      @par Complexity
+      Inserts `count` copies of `ch` at the position
+      `index` if `index <= size()` and the result fits
+      in the string. Unlike @ref insert, this function
+      never throws and does not invoke the overflow policy.
 
-      Linear.
+      @par Exception Safety
 
-      @note An empty string is always found.
+      No-throw guarantee. The string is unchanged
+      if the characters are not inserted.
 
-      @return The lowest index `idx` greater than or equal to `pos`
-      where each element of `{s, s + count)` is equal to that of
-      `{begin() + idx, begin() + idx + count)` if one exists,
-      and @ref npos otherwise.
+      @return `true` if the characters were inserted.
 
-      @param s The string to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      @param index The index to insert at.
+      @param count The number of characters to insert.
+      @param ch The character to insert.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find(
-    const_pointer s,
-    size_type pos = 0) const noexcept
+  bool
+  try_insert(
+    size_type index,
+    size_type count,
+    value_type ch) noexcept
   {
-    return find(s, pos, traits_type::length(s));
+    const auto curr_size = size();
+    if (index > curr_size || count > max_size() - curr_size)
+      return false;
+    const auto curr_data = data();
+    traits_type::move(&curr_data[index + count], &curr_data[index], curr_size - index + 1);
+    traits_type::assign(&curr_data[index], count, ch);
+    this->set_size(curr_size + count);
+    return true;
   }
 
-  /** Find the first occurrence of a character within the string.
+  /** Insert into the string, if it fits.
 
-      Finds the first occurrence of `c` within the string
-      starting at the index `pos`.
+      Inserts the characters in the range `{s, s + count)`
+      at the position `index` if `index <= size()` and the
+      result fits in the string. The inserted characters
+      may be part of the string. Unlike @ref insert, this
+      function never throws and does not invoke the
+      overflow policy.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not inserted.
 
-      @return The index corrosponding to the first occurrence of `c` within
-      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+      @return `true` if the characters were inserted.
 
-      @param c The character to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      @param index The index to insert at.
+      @param s The string to insert.
+      @param count The length of the string to insert.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find(
-    value_type c,
-    size_type pos = 0) const noexcept
+  bool
+  try_insert(
+    size_type index,
+    const_pointer s,
+    size_type count) noexcept
   {
-    return find(&c, pos, 1);
+    if (index > size() || count > max_size() - size())
+      return false;
+    // cannot overflow or throw after the checks above
+    insert(data() + index, s, s + count);
+    return true;
   }
 
+  /** Insert into the string, if it fits.
 
-  /** Find the last occurrence of a string within the string.
-
-      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
-      the last occurrence of `sv` within the string starting before or at
-      the index `pos`.
+      Inserts `sv`, where `sv` is `string_view_type(t)`,
+      at the position `index` if `index <= size()` and
+      the result fits in the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not inserted.
 
       @tparam T The type of the object to convert.
 
       @par Constraints
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
-      @return The highest index `idx` less than or equal to `pos`
-      where each element of `{sv.begin(), sv.end())` is equal to
-      that of `{begin() + idx, begin() + idx + count)` if one exists,
-      and @ref npos otherwise.
+      @return `true` if the characters were inserted.
 
-      @param t The string to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is @ref npos.
+      @param index The index to insert at.
+      @param t The string to insert.
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  rfind(
-    const T& t,
-    size_type pos = npos) const
-#ifdef BOOST_STATIC_STRING_DOCS
-      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
-#else
-      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
-#endif
+  bool
+  try_insert(
+    size_type index,
+    const T& t) noexcept
   {
     detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return rfind(sv.data(), pos, sv.size());
+    return try_insert(index, sv.data(), sv.size());
   }
 
-  /** Find the last occurrence of a string within the string.
+  /** Insert into the string, if it fits.
 
-      Finds the last occurrence of `str` within the string
-      starting before or at the index `pos`.
+      Inserts `s` at the position `index` if
+      `index <= size()` and the result fits in the
+      string. The string `s` may be `*this`, and may
+      have a different overflow policy.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not inserted.
 
-      @return The highest index `idx` less than or equal to `pos`
-      where each element of `str` is equal to that
-      of `{begin() + idx, begin() + idx + str.size())`
-      if one exists, and @ref npos otherwise.
+      @tparam M The size of the string to insert.
 
-      @param str The string to search for.
-      @param pos The index to start searching at. The default argument for
-      this parameter is @ref npos.
+      @return `true` if the characters were inserted.
+
+      @param index The index to insert at.
+      @param s The string to insert.
   */
-  template<std::size_t M>
+  template<std::size_t M, typename OtherPolicy>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  rfind(
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos = npos) const noexcept
+  bool
+  try_insert(
+    size_type index,
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s) noexcept
   {
-    return rfind(str.data(), pos, str.size());
+    return try_insert(index, s.data(), s.size());
   }
 
-  /** Find the last occurrence of a string within the string.
+  /** Insert into the string, if it fits.
 
-      Finds the last occurrence of the string pointed to
-      by `s` within the string starting before or at
-      the index `pos`.
+      Inserts `sub`, where `sub` is `s.substr(pos, count)`,
+      at the position `index` if `index <= size()`,
+      `pos <= s.size()` and the result fits in the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not inserted.
 
-      @return The highest index `idx` less than or equal to `pos`
-      where each element of `{s, s + n)` is equal to that of
-      `{begin() + idx, begin() + idx + n)` if one exists,
-      and @ref npos otherwise.
+      @tparam M The size of the string to insert.
 
-      @param s The string to search for.
-      @param pos The index to start searching at.
-      @param n The length of the string to search for.
+      @return `true` if the characters were inserted.
+
+      @param index The index to insert at.
+      @param s The string to insert.
+      @param pos The index at which to begin the substring.
+      @param count The size of the substring. The default
+      argument for this parameter is @ref npos.
   */
+  template<std::size_t M, typename OtherPolicy>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  rfind(
-    const_pointer s,
+  bool
+  try_insert(
+    size_type index,
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s,
     size_type pos,
-    size_type n) const noexcept;
+    size_type count = npos) noexcept
+  {
+    if (pos > s.size())
+      return false;
+    return try_insert(index, s.data() + pos,
+      (std::min)(count, s.size() - pos));
+  }
 
-  /** Find the last occurrence of a string within the string.
+  /** Replace a part of the string, if the result fits.
 
-      Finds the last occurrence of the string pointed to by `s`
-      of length `count` within the string starting before or at the
-      index `pos`, where `count` is `traits_type::length(s)`.
+      Replaces `rcount` characters starting at index `pos`
+      with those of `{s, s + n2)`, where `rcount` is
+      `std::min(n1, size() - pos)`, if `pos <= size()` and
+      the result fits in the string. The replacement may
+      be part of the string. Unlike @ref replace, this
+      function never throws and does not invoke the
+      overflow policy.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not replaced.
 
-      @return The highest index `idx` less than or equal to `pos`
-      where each element of `{s, s + count)` is equal to that of
-      `{begin() + idx, begin() + idx + count)` if one exists,
-      and @ref npos otherwise.
+      @return `true` if the characters were replaced.
 
-      @param s The string to search for.
-      @param pos The index to stop searching at. The default argument
-      for this parameter is @ref npos.
+      @param pos The index to replace at.
+      @param n1 The number of characters to replace.
+      @param s The string to replace with.
+      @param n2 The length of the string to replace with.
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  rfind(
+  bool
+  try_replace(
+    size_type pos,
+    size_type n1,
     const_pointer s,
-    size_type pos = npos) const noexcept
+    size_type n2) noexcept
   {
-    return rfind(s, pos, traits_type::length(s));
+    if (pos > size())
+      return false;
+    n1 = capped_length(pos, n1);
+    if (n2 > max_size() - (size() - n1))
+      return false;
+    // cannot overflow or throw after the checks above
+    replace(data() + pos, data() + pos + n1, s, s + n2);
+    return true;
   }
 
-  /** Find the last occurrence of a character within the string.
+  /** Replace a part of the string, if the result fits.
 
-      Finds the last occurrence of `c` within the string
-      starting before or at the index `pos`.
+      Replaces `rcount` characters starting at index `pos`
+      with those of `sv`, where `rcount` is
+      `std::min(n1, size() - pos)` and `sv` is
+      `string_view_type(t)`, if `pos <= size()` and
+      the result fits in the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not replaced.
 
-      @return The index corrosponding to the last occurrence of `c` within
-      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+      @tparam T The type of the object to convert.
 
-      @param c The character to search for.
-      @param pos The index to stop searching at. The default argument
-      for this parameter is @ref npos.
+      @par Constraints
+
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
+
+      @return `true` if the characters were replaced.
+
+      @param pos The index to replace at.
+      @param n1 The number of characters to replace.
+      @param t The string to replace with.
   */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  rfind(
-    value_type c,
-    size_type pos = npos) const noexcept
+  bool
+  try_replace(
+    size_type pos,
+    size_type n1,
+    const T& t) noexcept
   {
-    return rfind(&c, pos, 1);
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return try_replace(pos, n1, sv.data(), sv.size());
   }
 
-  /** Find the first occurrence of any of the characters within the string.
+  /** Replace a part of the string, if the result fits.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
-      the first occurrence of any of the characters in `sv`
-      within the string starting at the index `pos`.
+      Replaces `rcount` characters starting at index `pos`
+      with those of `str`, where `rcount` is
+      `std::min(n1, size() - pos)`, if `pos <= size()` and
+      the result fits in the string. The string `str` may
+      be `*this`, and may have a different overflow policy.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      No-throw guarantee. The string is unchanged
+      if the characters are not replaced.
 
-      @tparam T The type of the object to convert.
+      @tparam M The size of the input string.
 
-      @par Constraints
+      @return `true` if the characters were replaced.
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @param pos The index to replace at.
+      @param n1 The number of characters to replace.
+      @param str The string to replace with.
+  */
+  template<std::size_t M, typename OtherPolicy>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  try_replace(
+    size_type pos,
+    size_type n1,
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& str) noexcept
+  {
+    return try_replace(pos, n1, str.data(), str.size());
+  }
 
-      @return The index corrosponding to the first occurrence of
-      any of the characters in `{sv.begin(), sv.end())` within
-      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+  /** Replace a part of the string, if the result fits.
 
-      @param t The characters to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      Replaces `rcount` characters starting at index `pos1`
+      with those of `sub`, where `rcount` is
+      `std::min(n1, size() - pos1)` and `sub` is
+      `str.substr(pos2, n2)`, if `pos1 <= size()`,
+      `pos2 <= str.size()` and the result fits in the string.
+
+      @par Exception Safety
+
+      No-throw guarantee. The string is unchanged
+      if the characters are not replaced.
+
+      @tparam M The size of the input string.
+
+      @return `true` if the characters were replaced.
+
+      @param pos1 The index to replace at.
+      @param n1 The number of characters to replace.
+      @param str The string to replace with.
+      @param pos2 The index at which to begin the substring.
+      @param n2 The size of the substring. The default
+      argument for this parameter is @ref npos.
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
+  template<std::size_t M, typename OtherPolicy>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_of(
-    const T& t,
-    size_type pos = 0) const
-#ifdef BOOST_STATIC_STRING_DOCS
-      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
-#else
-      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
-#endif
+  bool
+  try_replace(
+    size_type pos1,
+    size_type n1,
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& str,
+    size_type pos2,
+    size_type n2 = npos) noexcept
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return find_first_of(sv.data(), pos, sv.size());
+    if (pos2 > str.size())
+      return false;
+    return try_replace(pos1, n1, str.data() + pos2,
+      (std::min)(n2, str.size() - pos2));
   }
 
-  /** Find the first occurrence of any of the characters within the string.
+  /** Append to the string.
 
-      Finds the first occurrence of any of the characters within `str` within the
-      string starting at the index `pos`.
+      Appends `s` to the end of the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      Strong guarantee.
 
-      @return The index corrosponding to the first occurrence of any of the characters
-      of `str` within `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+      @tparam M The size of the string to append.
 
-      @param str The characters to search for.
-      @param pos The index to start searching at. The default argument for
-      this parameter is `0`.
+      @return `*this`
+
+      @param s The string to append.
+
+      @throw std::length_error `size() + s.size() > max_size()`
   */
   template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_of(
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos = 0) const noexcept
+  basic_static_string&
+  operator+=(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s)
   {
-    return find_first_of(str.data(), pos, str.size());
+    return append(s);
   }
 
-  /** Find the first occurrence of any of the characters within the string.
+  /** Append to the string.
 
-      Finds the first occurrence of any of the characters within the string pointed to
-      by `s` within the string starting at the index `pos`.
+      Appends a character to the end of the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      Strong guarantee.
 
-      @return The index corrosponding to the first occurrence
-      of any of the characters in `{s, s + n)` within `{begin() + pos, end())`
-      if it exists, and @ref npos otherwise.
+      @param ch The character to append.
 
-      @param s The characters to search for.
-      @param pos The index to start searching at.
-      @param n The length of the string to search for.
+      @throw std::length_error `size() >= max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_of(
-    const_pointer s,
-    size_type pos,
-    size_type n) const noexcept;
+  basic_static_string&
+  operator+=(value_type ch)
+  {
+    push_back(ch);
+    return *this;
+  }
 
-  /** Find the first occurrence of any of the characters within the string.
+  /** Append to the string.
 
-      Finds the first occurrence of the any of the characters within string
-      pointed to by `s` of length `count` within the string starting at the
-      index `pos`, where `count` is `traits_type::length(s)`.
+      Appends `count` characters from the string pointed
+      to by `s` to the end of the string, where `count`
+      is `traits_type::length(s)`.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      Strong guarantee.
 
-      @return The index corrosponding to the first occurrence of any of
-      the characters in `{s, s + count)` within
-      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+      @return `*this`
 
-      @param s The characters to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      @param s The string to append.
+
+      @throw std::length_error `size() + count > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_of(
-    const_pointer s,
-    size_type pos = 0) const noexcept
+  basic_static_string&
+  operator+=(const_pointer s)
   {
-    return find_first_of(s, pos, traits_type::length(s));
+    return append(s);
   }
 
-  /** Find the first occurrence of a character within the string.
+  /** Append to the string.
 
-      Finds the first occurrence of `c` within the string
-      starting at the index `pos`.
+      Appends the characters from `ilist` to the
+      end of the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      Strong guarantee.
 
-      @return The index corrosponding to the first occurrence of `c` within
-      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+      @return `*this`
 
-      @param c The character to search for.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      @param ilist The initializer list to append.
+
+      @throw std::length_error `size() + ilist.size() > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_of(
-    value_type c,
-    size_type pos = 0) const noexcept
+  basic_static_string&
+  operator+=(
+    std::initializer_list<value_type> ilist)
   {
-    return find_first_of(&c, pos, 1);
+    return append(ilist);
   }
 
-  /** Find the last occurrence of any of the characters within the string.
+  /** Append to the string.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
-      the last occurrence of any of the characters in `sv`
-      within the string before or at the index `pos`.
+      Appends `sv` to the end of the string,
+      where `sv` is `string_view_type(t)`.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      Strong guarantee.
 
       @tparam T The type of the object to convert.
 
       @par Constraints
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value
+      @endcode
 
-      @return The index corrosponding to the last occurrence of
-      any of the characters in `{sv.begin(), sv.end())` within
-      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+      @return `*this`
 
-      @param t The characters to search for.
-      @param pos The index to stop searching at. The default argument
-      for this parameter is @ref npos.
+      @param t The string to append.
+
+      @throw std::length_error `size() + sv.size() > max_size()`
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_of(
-    const T& t,
-    size_type pos = npos) const
-#ifdef BOOST_STATIC_STRING_DOCS
-      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
-#else
-      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
-#endif
+  basic_static_string&
+  operator+=(const T& t)
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return find_last_of(sv.data(), pos, sv.size());
+    return append(t);
   }
 
-  /** Find the last occurrence of any of the characters within the string.
+  /** Compare a string with the string.
 
-      Finds the last occurrence of any of the characters within `str` within the
-      string starting before or at the index `pos`.
+      Let `comp` be `traits_type::compare(data(), s.data(), std::min(size(), s.size())`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `size() == s.size()`, `-1` if `size() < s.size()`, and `1`
+      otherwise.
 
       @par Complexity
-
       Linear.
 
-      @return The index corrosponding to the last occurrence of any of the characters
-      of `str` within `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+      @return The result of lexicographically comparing `s` and the string.
 
-      @param str The characters to search for.
-      @param pos The index to stop searching at. The default argument for
-      this parameter is @ref npos.
+      @tparam M The size of the string to compare with.
+
+      @param s The string to compare.
   */
   template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_of(
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos = npos) const noexcept
+  int
+  compare(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s) const noexcept
   {
-    return find_last_of(str.data(), pos, str.size());
+    return detail::lexicographical_compare<CharT, Traits>(
+      data(), size(), s.data(), s.size());
   }
 
-  /** Find the last occurrence of any of the characters within the string.
+  /** Compare a string with the string.
 
-      Finds the last occurrence of any of the characters within the string pointed to
-      by `s` within the string before or at the index `pos`.
+    Let `sub` be `substr(pos1, count1)` and `comp` be
+    `traits_type::compare(sub.data(), s.data(), std::min(sub.size(), s.size())`.
+    If `comp != 0`, then the result is `comp`. Otherwise, the result is
+    `0` if `sub.size() == s.size()`, `-1` if `sub.size() < s.size()`, and `1`
+    otherwise.
 
-      @par Complexity
+    @par Complexity
 
-      Linear.
+    Linear.
 
-      @return The index corrosponding to the last occurrence
-      of any of the characters in `{s, s + n)` within `{begin(), begin() + pos}`
-      if it exists, and @ref npos otherwise.
+    @par Exception Safety
 
-      @param s The characters to search for.
-      @param pos The index to stop searching at.
-      @param n The length of the string to search for.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_of(
-    const_pointer s,
-    size_type pos,
-    size_type n) const noexcept;
+    Strong guarantee.
 
-  /** Find the last occurrence of any of the characters within the string.
+    @return The result of lexicographically comparing `sub` and `s`.
 
-      Finds the last occurrence of any of the characters within the string pointed to
-      by `s` of length `count` within the string before or at the index `pos`,
-      where `count` is `traits_type::length(s)`.
+    @tparam M The size of the string to compare with.
 
-      @par Complexity
+    @param pos1 The index at which to begin the substring.
 
-      Linear.
+    @param count1 The size of the substring.
 
-      @return The index corrosponding to the last occurrence
-      of any of the characters in `{s, s + count)` within `{begin(), begin() + pos}`
-      if it exists, and @ref npos otherwise.
+    @param s The string to compare.
 
-      @param s The characters to search for.
-      @param pos The index to stop searching at. The default argument for
-      this parameter is @ref npos.
-  */
+    @throw std::out_of_range `pos1 > size()`
+    */
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_of(
-    const_pointer s,
-    size_type pos = npos) const noexcept
+  int
+  compare(
+    size_type pos1,
+    size_type count1,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s) const
   {
-    return find_last_of(s, pos, traits_type::length(s));
+    return detail::lexicographical_compare<CharT, Traits>(
+      data() + pos1, capped_length(pos1, count1), s.data(), s.size());
   }
 
-  /** Find the last occurrence of a character within the string.
+  /** Compare a string with the string.
 
-      Finds the last occurrence of `c` within the string
-      before or at the index `pos`.
+      Let `sub1` be `substr(pos1, count1)`, `sub2` be
+      `s.substr(pos2, count2)`, and `comp` be
+      `traits_type::compare(sub1.data(), sub2.data(), std::min(sub1.size(), sub2.size())`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `sub1.size() == sub2.size()`, `-1` if `sub1.size() < sub2.size()`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
-      @return The index corrosponding to the last occurrence of `c` within
-      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
-
-      @param c The character to search for.
-      @param pos The index to stop searching at. The default argument
-      for this parameter is @ref npos.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_of(
-    value_type c,
-    size_type pos = npos) const noexcept
-  {
-    return find_last_of(&c, pos, 1);
-  }
+      @par Exception Safety
 
-  /** Find the first occurrence of a character not within the string.
+      Strong guarantee.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
-      the first character that is not within `sv`, starting at the index `pos`.
+      @return The result of lexicographically comparing `sub1` and `sub2`.
 
-      @par Complexity
+      @param pos1 The index at which to begin the substring.
 
-      Linear.
+      @param count1 The size of the substring.
 
-      @tparam T The type of the object to convert.
+      @param s The string to compare.
 
-      @par Constraints
+      @param pos2 The index at which to begin the substring to compare.
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @param count2 The size of the substring to compare.
 
-      @return The index corrosponding to the first occurrence of
-      a character that is not in `{sv.begin(), sv.end())` within
-      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+      @throw std::out_of_range `pos1 > size()`
 
-      @param t The characters to ignore.
-      @param pos The index to start searching at. The default argument
-      for this parameter is `0`.
+      @throw std::out_of_range `pos2 > s.size()`
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
+  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_not_of(
-    const T& t,
-    size_type pos = 0) const
-#ifdef BOOST_STATIC_STRING_DOCS
-      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
-#else
-      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
-#endif
+  int
+  compare(
+    size_type pos1,
+    size_type count1,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& s,
+    size_type pos2,
+    size_type count2 = npos) const
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return find_first_not_of(sv.data(), pos, sv.size());
+    return detail::lexicographical_compare<CharT, Traits>(
+      data() + pos1, capped_length(pos1, count1),
+      s.data() + pos2, s.capped_length(pos2, count2));
   }
 
-  /** Find the first occurrence of any of the characters not within the string.
+  /** Compare a string with the string.
 
-      Finds the first occurrence of a character that is not within `str`
-      within the string starting at the index `pos`.
+      Let `len` be `traits_type::length(s)` and `comp` be
+      `traits_type::compare(data(), s, std::min(size(), len)`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `size() == len`, `-1` if `size() < len`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
-      @return The index corrosponding to the first character of `{begin() + pos, end())`
-      that is not within `str` if it exists, and @ref npos otherwise.
+      @return The result of lexicographically comparing `s` and the string.
 
-      @param str The characters to ignore.
-      @param pos The index to start searching at. The default argument for
-      this parameter is `0`.
+      @param s The string to compare.
   */
-  template<std::size_t M>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_not_of(
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos = 0) const noexcept
+  int
+  compare(const_pointer s) const noexcept
   {
-    return find_first_not_of(str.data(), pos, str.size());
+    return detail::lexicographical_compare<CharT, Traits>(
+      data(), size(), s, traits_type::length(s));
   }
 
-  /** Find the first occurrence of any of the characters not within the string.
+  /** Compare a string with the string.
 
-      Finds the first occurrence of a character that is not within the string
-      pointed to by `s` within the string starting at the index `pos`.
+      Let `sub` be `substr(pos1, count1)`, `len` be
+      `traits_type::length(s)`, and `comp` be
+      `traits_type::compare(sub.data(), s, std::min(size(), len)`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `sub.size() == len`, `-1` if `sub.size() < len`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
-      @return The index corrosponding to the first character of `{begin() + pos, end())`
-      that is not within `{s, s + n)` if it exists, and @ref npos otherwise.
-
-      @param s The characters to ignore.
-      @param pos The index to start searching at. The default argument for
-      this parameter is `0`.
-      @param n The length of the characters to ignore.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_not_of(
-    const_pointer s,
-    size_type pos,
-    size_type n) const noexcept;
+      @par Exception Safety
 
-  /** Find the first occurrence of any of the characters not within the string.
+      Strong guarantee.
 
-      Finds the first occurrence of a character that is not within the string
-      pointed to by `s` of length `count` within the string starting
-      at the index `pos`, where `count` is `traits_type::length(s)`.
+      @return The result of lexicographically comparing `s` and `sub`.
 
-      @par Complexity
+      @param pos1 The index at which to begin the substring.
 
-      Linear.
+      @param count1 The size of the substring.
 
-      @return The index corrosponding to the first character of `{begin() + pos, end())`
-      that is not within `{s, s + count)` if it exists, and @ref npos otherwise.
+      @param s The string to compare.
 
-      @param s The characters to ignore.
-      @param pos The index to start searching at. The default argument for
-      this parameter is `0`.
+      @throw std::out_of_range `pos1 > size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_not_of(
-    const_pointer s,
-    size_type pos = 0) const noexcept
+  int
+  compare(
+    size_type pos1,
+    size_type count1,
+    const_pointer s) const
   {
-    return find_first_not_of(s, pos, traits_type::length(s));
+    return detail::lexicographical_compare<CharT, Traits>(
+      data() + pos1, capped_length(pos1, count1), s, traits_type::length(s));
   }
 
-  /** Find the first occurrence of a character not equal to `c`.
+  /** Compare a string with the string.
 
-      Finds the first occurrence of a character that is not equal
-      to `c`.
+      Let `sub` be `substr(pos1, count1)`, and `comp` be
+      `traits_type::compare(sub.data(), s, std::min(size(), count2)`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `sub.size() == count2`, `-1` if `sub.size() < count2`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
-      @return The index corrosponding to the first character of `{begin() + pos, end())`
-      that is not equal to `c` if it exists, and @ref npos otherwise.
+      @par Exception Safety
 
-      @param c The character to ignore.
-      @param pos The index to start searching at. The default argument for
-      this parameter is `0`.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_first_not_of(
-    value_type c,
-    size_type pos = 0) const noexcept
-  {
-    return find_first_not_of(&c, pos, 1);
-  }
+      Strong guarantee.
 
-  /** Find the last occurrence of a character not within the string.
+      @return The result of lexicographically comparing `s` and `sub`.
 
-      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
-      the last character that is not within `sv`, starting at the index `pos`.
+      @param pos1 The index at which to begin the substring.
+
+      @param count1 The size of the substring.
+
+      @param s The string to compare.
+
+      @param count2 The length of the string to compare.
+
+      @throw std::out_of_range `pos1 > size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  int
+  compare(
+    size_type pos1,
+    size_type count1,
+    const_pointer s,
+    size_type count2) const
+  {
+    return detail::lexicographical_compare<CharT, Traits>(
+      data() + pos1, capped_length(pos1, count1), s, count2);
+  }
+
+  /** Compare a string with the string.
+
+      Let `s` be `string_view_type(t)` and `comp` be
+      `traits_type::compare(data(), s.data(), std::min(size(), s.size())`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `size() == s.size()`, `-1` if `size() < s.size()`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
+      @par Exception Safety
+
+      Strong guarantee.
+
       @tparam T The type of the object to convert.
 
       @par Constraints
 
-      `std::is_convertible<const T&, string_view>::value &&
-      !std::is_convertible<const T&, const CharT*>::value &&
-      !std::is_convertible<const T&, const basic_static_string&>::value`.
+      @code
+      std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const_pointer>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value.
+      @endcode
 
-      @return The index corrosponding to the last occurrence of
-      a character that is not in `{sv.begin(), sv.end())` within
-      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+      @return The result of lexicographically comparing `s` and the string.
 
-      @param t The characters to ignore.
-      @param pos The index to start searching at. The default argument
-      for this parameter is @ref npos.
+      @param t The string to compare.
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_not_of(
-    const T& t,
-    size_type pos = npos) const
-#ifdef BOOST_STATIC_STRING_DOCS
-      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
-#else
-      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
-#endif
+  int
+  compare(const T& t) const noexcept
   {
     detail::common_string_view_type<T, CharT, Traits> sv = t;
-    return find_last_not_of(sv.data(), pos, sv.size());
+    return detail::lexicographical_compare<CharT, Traits>(
+      data(), size(), sv.data(), sv.size());
   }
 
-  /** Find the last occurrence of a character not within the string.
+  /** Compare a string with the string.
 
-      Finds the last occurrence of a character that is not within `str`
-      within the string before or at the index `pos`.
+      Let `s` be `string_view_type(t)`, `sub` be
+      `substr(pos1, count1)`, and `comp` be
+      `traits_type::compare(sub.data(), s.data(), std::min(sub.size(), s.size())`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `sub.size() == s.size()`, `-1` if `sub.size() < s.size()`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
-      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
-      that is not within `str` if it exists, and @ref npos otherwise.
+      @par Exception Safety
 
-      @param str The characters to ignore.
-      @param pos The index to stop searching at. The default argument for
-      this parameter is @ref npos.
-  */
-  template<size_t M>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_not_of(
-    const basic_static_string<M, CharT, Traits>& str,
-    size_type pos = npos) const noexcept
-  {
-    return find_last_not_of(str.data(), pos, str.size());
-  }
+      Strong guarantee.
 
-  /** Find the last occurrence of a character not within the string.
+      @tparam T The type of the object to convert.
 
-      Finds the last occurrence of a character that is not within the
-      string pointed to by `s` within the string before or at the index `pos`.
+      @par Constraints
 
-      @par Complexity
+      @code
+      std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const_pointer>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value.
+      @endcode
 
-      Linear.
+      @return The result of lexicographically comparing `s` and `sub`.
 
-      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
-      that is not within `{s, s + n)` if it exists, and @ref npos otherwise.
+      @param pos1 The index at which to begin the substring.
 
-      @param s The characters to ignore.
-      @param pos The index to stop searching at. The default argument for
-      this parameter is @ref npos.
-      @param n The length of the characters to ignore.
+      @param count1 The length of the substring.
+
+      @param t The string to compare.
   */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_not_of(
-    const_pointer s,
-    size_type pos,
-    size_type n) const noexcept;
-
+  int
+  compare(
+    size_type pos1,
+    size_type count1,
+    const T& t) const
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return detail::lexicographical_compare<CharT, Traits>(
+      data() + pos1, capped_length(pos1, count1), sv.data(), sv.size());
+  }
 
-  /** Find the last occurrence of a character not within the string.
+  /** Compare a string with the string.
 
-      Finds the last occurrence of a character that is not within the
-      string pointed to by `s` of length `count` within the string
-      before or at the index `pos`, where `count` is `traits_type::length(s)`.
+      Let `sub1` be `substr(pos1, count1)`, `sub2` be
+      `string_view_type(t).substr(pos2, count2)`, and `comp` be
+      `traits_type::compare(sub1.data(), sub2.data(), std::min(sub1.size(), sub2.size())`.
+      If `comp != 0`, then the result is `comp`. Otherwise, the result is
+      `0` if `sub1.size() == sub2.size()`, `-1` if `sub1.size() < sub2.size()`, and `1`
+      otherwise.
 
       @par Complexity
 
       Linear.
 
-      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
-      that is not within `{s, s + count)` if it exists, and @ref npos otherwise.
-
-      @param s The characters to ignore.
-      @param pos The index to stop searching at. The default argument for
-      this parameter is @ref npos.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_not_of(
-    const_pointer s,
-    size_type pos = npos) const noexcept
-  {
-    return find_last_not_of(s, pos, traits_type::length(s));
-  }
-
-  /** Find the last occurrence of a character not equal to `c`.
+      @par Exception Safety
 
-      Finds the last occurrence of a character that is not equal
-      to `c` before or at the index `pos`.
+      Strong guarantee.
 
-      @par Complexity
+      @tparam T The type of the object to convert.
 
-      Linear.
+      @par Constraints
 
-      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
-      that is not equal to `c` if it exists, and @ref npos otherwise.
+      @code
+      std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const_pointer>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value.
+      @endcode
 
-      @param c The character to ignore.
-      @param pos The index to start searching at. The default argument for
-      this parameter is @ref npos.
-  */
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  find_last_not_of(
-    value_type c,
-    size_type pos = npos) const noexcept
-  {
-    return find_last_not_of(&c, pos, 1);
-  }
+      @return The result of lexicographically comparing `sub1` and `sub2`.
 
-  /** Return whether the string begins with a string.
+      @param pos1 The index at which to begin the substring in the string.
 
-      Returns `true` if the string begins with `s`, and `false` otherwise.
+      @param count1 The length of the substring in the string.
 
-      @par Complexity
+      @param t The string to compare.
 
-      Linear.
+      @param pos2 The index at which to begin the substring in the string view.
 
-      @param t The string view to check for.
+      @param count2 The length of the substring in the string view.
   */
   template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-            , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
   >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  bool
-  starts_with(
-    T const& t) const noexcept
+  int
+  compare(
+    size_type pos1,
+    size_type count1,
+    const T& t,
+    size_type pos2,
+    size_type count2 = npos) const
   {
     detail::common_string_view_type<T, CharT, Traits> sv = t;
-    const size_type len = sv.size();
-    return size() >= len && !traits_type::compare(data(), sv.data(), len);
+    if ( pos2 > sv.size())
+      detail::throw_exception<std::out_of_range>("pos2 > sv.size()");
+    return compare(
+        pos1, count1, sv.data() + pos2,
+        (std::min)(sv.size() - pos2, count2));
   }
 
-  /** Return whether the string begins with a character.
+  /** Return a substring.
 
-      Returns `true` if the string begins with `c`, and `false` otherwise.
+      Returns a substring of the string.
 
-      @par Complexity
+      @par Exception Safety
 
-      Constant.
+      Strong guarantee.
 
-      @param c The character to check for.
+      @return A string object containing the characters
+      `{data() + pos, std::min(count, size() - pos))`.
+
+      @param pos The index to being the substring at. The
+      default arugment for this parameter is `0`.
+      @param count The length of the substring. The default arugment
+      for this parameter is @ref npos.
+
+      @throw std::out_of_range `pos > size()`
   */
+#ifndef BOOST_STATIC_STRING_GCC5_BAD_CONSTEXPR
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  bool
-  starts_with(
-    value_type c) const noexcept
+#endif
+  basic_static_string
+  substr(
+    size_type pos = 0,
+    size_type count = npos) const
   {
-    return !empty() && traits_type::eq(front(), c);
+    return basic_static_string(
+      data() + pos, capped_length(pos, count));
   }
 
-  /** Return whether the string begins with a string.
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+  /** Return a string view of a substring.
 
-      Returns `true` if the string begins with the string
-      pointed to be `s` of length `traits_type::length(s)`,
-      and `false` otherwise.
+      Returns a view of a substring.
 
-      @par Complexity
+      @par Exception Safety
 
-      Linear.
+      Strong guarantee.
 
-      @param s The string to check for.
+      @return A `string_view_type` object referring
+      to `{data() + pos, std::min(count, size() - pos))`.
+
+      @param pos The index to being the substring at. The
+      default arugment for this parameter is `0`.
+      @param count The length of the substring. The default arugment
+      for this parameter is @ref npos.
+
+      @throw std::out_of_range `pos > size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  bool
-  starts_with(
-    const_pointer s) const noexcept
+  string_view_type
+  subview(
+    size_type pos = 0,
+    size_type count = npos) const
   {
-    const size_type len = traits_type::length(s);
-    return size() >= len && !traits_type::compare(data(), s, len);
+    return string_view_type(
+      data() + pos, capped_length(pos, count));
   }
+#endif
 
-  /** Return whether the string ends with a string.
+  /** Copy a substring to another string.
 
-      Returns `true` if the string ends with `s`, and `false` otherwise.
+      Copies `std::min(count, size() - pos)` characters starting at
+      index `pos` to the string pointed to by `dest`.
 
-      @par Complexity
+      @note The resulting string is not null terminated.
 
-      Linear.
+      @return The number of characters copied.
 
-      @param t The string view to check for.
+      @param count The number of characters to copy.
+      @param dest The string to copy to.
+      @param pos The index to begin copying from. The
+      default argument for this parameter is `0`.
+
+      @throw std::out_of_range `pos > max_size()`
   */
-  template<typename T
-#ifndef BOOST_STATIC_STRING_DOCS
-            , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-  >
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  bool
-  ends_with(
-    T const& t) const noexcept
+  size_type
+  copy(
+    pointer dest,
+    size_type count,
+    size_type pos = 0) const
   {
-    detail::common_string_view_type<T, CharT, Traits> sv = t;
-    const size_type len = sv.size();
-    return size() >= len && !traits_type::compare(data() + (size() - len), sv.data(), len);
+    const auto num_copied = capped_length(pos, count);
+    traits_type::copy(dest, data() + pos, num_copied);
+    return num_copied;
   }
 
-  /** Return whether the string ends with a character.
-
-      Returns `true` if the string ends with `c`, and `false` otherwise.
+  /** Change the size of the string.
 
-      @par Complexity
+      Resizes the string to contain `n` characters. If
+      `n > size()`, characters with the value `CharT()` are
+      appended. Otherwise, `size()` is reduced to `n`.
 
-      Constant.
+      @param n The size to resize the string to.
 
-      @param c The character to check for.
+      @throw std::out_of_range `n > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  bool
-  ends_with(
-    value_type c) const noexcept
+  void
+  resize(size_type n)
   {
-    return !empty() && traits_type::eq(back(), c);
+    resize(n, value_type());
   }
 
-  /** Return whether the string ends with a string.
-
-      Returns `true` if the string ends with the string
-      pointed to be `s` of length `traits_type::length(s)`,
-      and `false` otherwise.
+  /** Change the size of the string.
 
-      @par Complexity
+      Resizes the string to contain `n` characters. If
+      `n > size()`, copies of `c` are
+      appended. Otherwise, `size()` is reduced to `n`.
 
-      Linear.
+      @param n The size to resize the string to.
+      @param c The characters to append if the size
+      increases.
 
-      @param s The string to check for.
+      @throw std::out_of_range `n > max_size()`
   */
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  bool
-  ends_with(
-    const_pointer s) const noexcept
-  {
-    const size_type len = traits_type::length(s);
-    return size() >= len && !traits_type::compare(data() + (size() - len), s, len);
-  }
+  void
+  resize(
+    size_type n,
+    value_type c);
 
-private:
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  term() noexcept
-  {
-    this->term_impl();
-    return *this;
-  }
+  /** Change the size of the string and write to it directly.
 
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign_char(value_type ch, std::true_type) noexcept
-  {
-    this->set_size(1);
-    traits_type::assign(data()[0], ch);
-    return term();
-  }
+      Calls `std::move(op)(p, n)`, where `p` is a pointer
+      to the characters of the string, and sets the size of
+      the string to the value `r` it returns. This lets a
+      producer such as a codec or `read` write into the
+      string without an intermediate buffer.
 
-  BOOST_STATIC_STRING_NORETURN
-  basic_static_string&
-  assign_char(value_type, std::false_type)
-  {
-    detail::throw_exception<std::length_error>("max_size() == 0");
-    // This eliminates any potential warnings
-#ifdef BOOST_STATIC_STRING_NO_NORETURN
-    return *this;
-#endif
-  }
+      Before the call, the characters in `{p, p + std::min(n, size()))`
+      hold the contents of the string, and those in
+      `{p + size(), p + n)` have unspecified values. The
+      operation may write to any character in
+      `{p, p + n + 1)`, and the null terminator is written
+      after it returns. When `max_size() == 0`, `p` points
+      to a scratch character which is not part of the string.
 
-  // Returns the size of data read from input iterator. Read data begins at data() + size() + 1.
-  template<typename InputIterator>
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  read_back(
-    bool overwrite_null,
-    InputIterator first,
-    InputIterator last);
+      @par Precondition
 
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace_unchecked(
-    size_type pos,
-    size_type n1,
-    const_pointer s,
-    size_type n2)
-  {
-    if (pos > size())
-      detail::throw_exception<std::out_of_range>(
-        "pos > size()");
-    return replace_unchecked(data() + pos, data() + pos + capped_length(pos, n1), s, n2);
-  }
+      `op` does not throw, and returns a value of an
+      integer type in `[0, n]`.
 
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  replace_unchecked(
-    const_iterator i1,
-    const_iterator i2,
-    const_pointer s,
-    size_type n2);
+      @par Example
 
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  insert_unchecked(
-    size_type index,
-    const_pointer s,
-    size_type count)
-  {
-    if (index > size())
-      detail::throw_exception<std::out_of_range>(
-        "index > size()");
-    insert_unchecked(data() + index, s, count);
-    return *this;
-  }
+      @code
+      static_string<512> s;
+      s.resize_and_overwrite(s.max_size(),
+        [&](char* p, std::size_t n) {
+          const auto r = ::read(fd, p, n);
+          return r < 0 ? 0 : std::size_t(r);
+        });
+      @endcode
 
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  iterator
-  insert_unchecked(
-    const_iterator pos,
-    const_pointer s,
-    size_type count);
+      @tparam Operation The type of the operation.
 
-  BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  basic_static_string&
-  assign_unchecked(
-    const_pointer s,
-    size_type count) noexcept
-  {
-    this->set_size(count);
-    traits_type::copy(data(), s, size() + 1);
-    return *this;
-  }
+      @param n The number of characters the operation may write.
+      @param op The operation to call.
 
+      @throw std::length_error `n > max_size()`
+  */
+  template<typename Operation>
   BOOST_STATIC_STRING_CPP14_CONSTEXPR
-  size_type
-  capped_length(
-    size_type index,
-    size_type length) const
-  {
-    if (index > size())
-      detail::throw_exception<std::out_of_range>(
-        "index > size()");
-    return (std::min)(size() - index, length);
+  void
+  resize_and_overwrite(
+    size_type n,
+    Operation op)
+  {
+    n = checked_count(n, max_size(), "n > max_size()");
+    // The terminator of an empty string may not be
+    // written to, so op gets a character of its own
+    value_type scratch[1] = {};
+    const auto r = std::move(op)(N ? data() : scratch, n);
+    // a negative result converts to a value greater than n
+    BOOST_STATIC_STRING_ASSERT(static_cast<size_type>(r) <= n);
+    this->set_size(size_type(r));
+    this->term_impl();
   }
-};
 
-//------------------------------------------------------------------------------
-//
-// Non-member functions
-//
-//------------------------------------------------------------------------------
+  /** Swap two strings.
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator==(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  return lhs.compare(rhs) == 0;
-}
+      Swaps the contents of the string and `s`.
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator!=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  return lhs.compare(rhs) != 0;
-}
+      @par Exception Safety
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator<(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  return lhs.compare(rhs) < 0;
-}
+      Strong guarantee.
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator<=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  return lhs.compare(rhs) <= 0;
-}
+      @par Complexity
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  return lhs.compare(rhs) > 0;
-}
+      Linear in `std::max(size(), s.size())`.
+
+      @note
+
+      All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @param s The string to swap with.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  swap(basic_static_string& s) noexcept;
+
+  /** Swap two strings.
+
+      Swaps the contents of the string and `s`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @par Complexity
+
+      Linear in `std::max(size(), s.size())`.
+
+      @note
+
+      All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      If the overflow policy returns when one of the
+      strings does not fit in the other, each string
+      receives as many of the leading characters of
+      the other as fit in its capacity.
+
+      @tparam M The size of the string to swap with.
+
+      @param s The string to swap with.
+
+      @throw std::length_error `s.size() > max_size() || size() > s.max_size()`
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  swap(basic_static_string<M, CharT, Traits, OverflowPolicy>& s);
+
+private:
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  swap_unchecked(basic_static_string<M, CharT, Traits, OverflowPolicy>& s) noexcept;
+
+public:
+
+  /** Replace a part of the string.
+
+      Replaces `rcount` characters starting at index `pos1` with those
+      of `str`, where `rcount` is `std::min(n1, size() - pos1)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note The replacement is done unchecked when
+      the capacity of `str` differs from that of the
+      string the function is called on.
+
+      All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @tparam M The size of the input string.
+
+      @return `*this`
+
+      @param pos1 The index to replace at.
+      @param n1 The number of characters to replace.
+      @param str The string to replace with.
+
+      @throw std::length_error `size() + (str.size() - rcount) > max_size()`
+      @throw std::out_of_range `pos1 > size()`
+  */
+  template<size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos1,
+    size_type n1,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str)
+  {
+    return replace_unchecked(pos1, n1, str.data(), str.size());
+  }
+
+#ifndef BOOST_STATIC_STRING_DOCS
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos1,
+    size_type n1,
+    const basic_static_string& str)
+  {
+    return replace(pos1, n1, str.data(), str.size());
+  }
+#endif
+
+  /** Replace a part of the string.
+
+      Replaces `rcount` characters starting at index `pos1` with those of
+      `str.subview(pos2, n2)`, where `rcount` is `std::min(n1, size() - pos1)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note The replacement is done unchecked when
+      the capacity of `str` differs from that of the
+      string the function is called on.
+
+      All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param pos1 The index to replace at.
+      @param n1 The number of characters to replace.
+      @param str The string to replace with.
+      @param pos2 The index to begin the substring.
+      @param n2 The length of the substring.
+      The default argument for this parameter is @ref npos.
+
+      @throw std::length_error `size() + (std::min(str.size(), n2) - rcount) > max_size()`
+      @throw std::out_of_range `pos1 > size()`
+      @throw std::out_of_range `pos2 > str.size()`
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos1,
+    size_type n1,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos2,
+    size_type n2 = npos)
+  {
+    return replace_unchecked(pos1, n1, str.data() + pos2, str.capped_length(pos2, n2));
+  }
+
+#ifndef BOOST_STATIC_STRING_DOCS
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos1,
+    size_type n1,
+    const basic_static_string& str,
+    size_type pos2,
+    size_type n2 = npos)
+  {
+    return replace(pos1, n1, str.data() + pos2, str.capped_length(pos2, n2));
+  }
+#endif
+
+  /** Replace a part of the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and
+      replaces `rcount` characters starting at index `pos1` with those
+      of `sv`, where `rcount` is `std::min(n1, size() - pos1)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return `*this`
+
+      @param pos1 The index to replace at.
+      @param n1 The number of characters to replace.
+      @param t The object to replace with.
+
+      @throw std::length_error `size() + (sv.size() - rcount) > max_size()`
+      @throw std::out_of_range `pos1 > size()`
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos1,
+    size_type n1,
+    const T& t)
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return replace(pos1, n1, sv.data(), sv.size());
+  }
+
+  /** Replace a part of the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and
+      replaces `rcount` characters starting at index `pos1` with those
+      of `sv.substr(pos2, n2)`, where `rcount` is `std::min(n1, size() - pos)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return `*this`
+
+      @param pos1 The index to replace at.
+      @param n1 The number of characters to replace.
+      @param t The object to replace with.
+      @param pos2 The index to begin the substring.
+      @param n2 The length of the substring.
+      The default argument for this parameter is @ref npos.
+
+      @throw std::length_error `size() + (std::min(n2, sv.size()) - rcount) > max_size()`
+      @throw std::out_of_range `pos1 > size()`
+      @throw std::out_of_range `pos2 > sv.size()`
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos1,
+    size_type n1,
+    const T& t,
+    size_type pos2,
+    size_type n2 = npos)
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    if ( pos2 > sv.size())
+      detail::throw_exception<std::out_of_range>("pos2 > t.size()");
+    return replace(
+        pos1, n1, sv.data() + pos2,
+        (std::min)(sv.size() - pos2, n2));
+  }
+
+  /** Replace a part of the string.
+
+      Replaces `rcount` characters starting at index `pos` with those of
+      `{s, s + n2)`, where `rcount` is `std::min(n1, size() - pos)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param pos The index to replace at.
+      @param n1 The number of characters to replace.
+      @param s The string to replace with.
+      @param n2 The length of the string to replace with.
+
+      @throw std::length_error `size() + (n2 - rcount) > max_size()`
+      @throw std::out_of_range `pos > size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos,
+    size_type n1,
+    const_pointer s,
+    size_type n2)
+  {
+    return replace(data() + pos, data() + pos + capped_length(pos, n1), s, n2);
+  }
+
+  /** Replace a part of the string.
+
+      Replaces `rcount` characters starting at index `pos` with those of
+      `{s, s + len)`, where the length of the string `len` is `traits_type::length(s)` and `rcount`
+      is `std::min(n1, size() - pos)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param pos The index to replace at.
+      @param n1 The number of characters to replace.
+      @param s The string to replace with.
+
+      @throw std::length_error `size() + (len - rcount) > max_size()`
+      @throw std::out_of_range `pos > size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos,
+    size_type n1,
+    const_pointer s)
+  {
+    return replace(pos, n1, s, traits_type::length(s));
+  }
+
+  /** Replace a part of the string.
+
+      Replaces `rcount` characters starting at index `pos` with `n2` copies
+      of `c`, where `rcount` is `std::min(n1, size() - pos)`.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param pos The index to replace at.
+      @param n1 The number of characters to replace.
+      @param n2 The number of characters to replace with.
+      @param c The character to replace with.
+
+      @throw std::length_error `size() + (n2 - rcount) > max_size()`
+      @throw std::out_of_range `pos > size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    size_type pos,
+    size_type n1,
+    size_type n2,
+    value_type c)
+  {
+    return replace(data() + pos, data() + pos + capped_length(pos, n1), n2, c);
+  }
+
+  /** Replace a part of the string.
+
+      Replaces the characters in the range `{i1, i2)`
+      with those of `str`.
+
+      @par Precondition
+
+      `{i1, i2)` is a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note The replacement is done unchecked when
+      the capacity of `str` differs from that of the
+      string the function is called on.
+
+      All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @tparam M The size of the input string.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator referring past the end of
+      the last character to replace.
+      @param str The string to replace with.
+
+      @throw std::length_error `size() + (str.size() - std::distance(i1, i2)) > max_size()`
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str)
+  {
+    return replace_unchecked(i1, i2, str.data(), str.size());
+  }
+
+#ifndef BOOST_STATIC_STRING_DOCS
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    const basic_static_string& str)
+  {
+    return replace(i1, i2, str.data(), str.size());
+  }
+#endif
+
+  /** Replace a part of the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and
+      replaces the characters in the range `{i1, i2)` with those
+      of `sv`.
+
+      @par Precondition
+
+      `{i1, i2)` is a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator referring past the end of
+      the last character to replace.
+      @param t The object to replace with.
+
+      @throw std::length_error `size() + (sv.size() - std::distance(i1, i2)) > max_size()`
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    const T& t)
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return replace(i1, i2, sv.data(), sv.data() + sv.size());
+  }
+
+  /** Replace a part of the string.
+
+      Replaces the characters in the range `{i1, i2)` with those of
+      `{s, s + n)`.
+
+      @par Precondition
+
+      `{i1, i2)` is a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator referring past the end of
+      the last character to replace.
+      @param s The string to replace with.
+      @param n The length of the string to replace with.
+
+      @throw std::length_error `size() + (n - std::distance(i1, i2)) > max_size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    const_pointer s,
+    size_type n)
+  {
+    return replace(i1, i2, s, s + n);
+  }
+
+  /** Replace a part of the string.
+
+      Replaces the characters in the range `{i1, i2)` with those of
+      `{s, s + len)`, where the length of the string `len` is `traits_type::length(s)`.
+
+      @par Precondition
+
+      `{i1, i2)` shall be a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator referring past the end of
+      the last character to replace.
+      @param s The string to replace with.
+
+      @throw std::length_error `size() + (len - std::distance(i1, i2)) > max_size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    const_pointer s)
+  {
+    return replace(i1, i2, s, traits_type::length(s));
+  }
+
+  /** Replace a part of the string.
+
+      Replaces the characters in the range `{i1, i2)` with
+      `n` copies of `c`.
+
+      @par Precondition
+
+      `{i1, i2)` is a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator past the end of
+      the last character to replace.
+      @param n The number of characters to replace with.
+      @param c The character to replace with.
+
+      @throw std::length_error `size() + (n - std::distance(i1, i2)) > max_size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    size_type n,
+    value_type c);
+
+  /** Replace a part of the string.
+
+      Replaces the characters in the range `{i1, i2)`
+      with those of `{j1, j2)`.
+
+      @par Precondition
+
+      `{i1, i2)` is a valid range.
+
+      `{j1, j2)` is a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @tparam InputIterator The type of the iterators.
+
+      @par Constraints
+
+      `InputIterator` satisfies __InputIterator__ and does not
+      satisfy __ForwardIterator__.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator referring past the end of
+      the last character to replace.
+      @param j1 An iterator referring to the first character to replace with.
+      @param j2 An iterator referring past the end of
+      the last character to replace with.
+
+      @throw std::length_error `size() + (inserted - std::distance(i1, i2)) > max_size()`
+  */
+  template<typename InputIterator>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+#ifdef BOOST_STATIC_STRING_DOCS
+  basic_static_string&
+#else
+  typename std::enable_if<
+    detail::is_input_iterator<
+      InputIterator>::value &&
+        !detail::is_forward_iterator<
+          InputIterator>::value,
+            basic_static_string<N, CharT, Traits, OverflowPolicy>&>::type
+#endif
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    InputIterator j1,
+    InputIterator j2);
+
+#ifndef BOOST_STATIC_STRING_DOCS
+  template<typename ForwardIterator>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  typename std::enable_if<
+    detail::is_forward_iterator<
+      ForwardIterator>::value,
+        basic_static_string<N, CharT, Traits, OverflowPolicy>&>::type
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    ForwardIterator j1,
+    ForwardIterator j2);
+#endif
+
+  /** Replace a part of the string.
+
+      Replaces the characters in the range `{i1, i2)`
+      with those of contained in the initializer list `il`.
+
+      @par Precondition
+
+      `{i1, i2)` is a valid range.
+
+      @par Exception Safety
+
+      Strong guarantee.
+
+      @note All references, pointers, or iterators
+      referring to contained elements are invalidated. Any
+      past-the-end iterators are also invalidated.
+
+      @return `*this`
+
+      @param i1 An iterator referring to the first character to replace.
+      @param i2 An iterator past the end of
+      the last character to replace.
+      @param il The initializer list to replace with.
+
+      @throw std::length_error `size() + (il.size() - std::distance(i1, i2)) > max_size()`
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace(
+    const_iterator i1,
+    const_iterator i2,
+    std::initializer_list<value_type> il)
+  {
+    return replace_unchecked(i1, i2, il.begin(), il.size());
+  }
+
+  //--------------------------------------------------------------------------
+  //
+  // Search
+  //
+  //--------------------------------------------------------------------------
+
+  /** Find the first occurrence of a string within the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
+      the first occurrence of `sv` within the string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @note An empty string is always found.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return The lowest index `idx` greater than or equal to `pos`
+      where each element of `{sv.begin(), sv.end())` is equal to
+      that of `{begin() + idx, begin() + idx + count)` if one exists,
+      and @ref npos otherwise.
+
+      @param t The string to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find(
+    const T& t,
+    size_type pos = 0) const
+#ifdef BOOST_STATIC_STRING_DOCS
+      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
+#else
+      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
+#endif
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return find(sv.data(), pos, sv.size());
+  }
+
+    /** Find the first occurrence of a string within the string.
+
+      Finds the first occurrence of `str` within the
+      string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The lowest index `idx` greater than or equal to `pos`
+      where each element of `str` is equal to that of
+      `{begin() + idx, begin() + idx + str.size())`
+      if one exists, and @ref npos otherwise.
+
+      @param str The string to search for.
+      @param pos The index to start searching at. The default argument for
+      this parameter is `0`.
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos = 0) const noexcept
+  {
+    return find(str.data(), pos, str.size());
+  }
+
+  /** Find the first occurrence of a string within the string.
+
+      Finds the first occurrence of the string pointed to
+      by `s` within the string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @note An empty string is always found.
+
+      @return The lowest index `idx` greater than or equal to `pos`
+      where each element of `{s, s + n)` is equal to that of
+      `{begin() + idx, begin() + idx + n)` if one exists,
+      and @ref npos otherwise.
+
+      @param s The string to search for.
+      @param pos The index to start searching at.
+      @param n The length of the string to search for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find(
+    const_pointer s,
+    size_type pos,
+    size_type n) const noexcept;
+
+  /** Find the first occurrence of a string within the string.
+
+      Finds the first occurrence of the string pointed to by `s`
+      of length `count` within the string starting at the index `pos`,
+      where `count` is `traits_type::length(s)`.
+
+      @par Complexity
+
+      Linear.
+
+      @note An empty string is always found.
+
+      @return The lowest index `idx` greater than or equal to `pos`
+      where each element of `{s, s + count)` is equal to that of
+      `{begin() + idx, begin() + idx + count)` if one exists,
+      and @ref npos otherwise.
+
+      @param s The string to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find(
+    const_pointer s,
+    size_type pos = 0) const noexcept
+  {
+    return find(s, pos, traits_type::length(s));
+  }
+
+  /** Find the first occurrence of a character within the string.
+
+      Finds the first occurrence of `c` within the string
+      starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first occurrence of `c` within
+      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+
+      @param c The character to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find(
+    value_type c,
+    size_type pos = 0) const noexcept
+  {
+    return find(&c, pos, 1);
+  }
+
+  /** Find the first occurrence of a string within the string.
+
+      Finds the first occurrence of the needle of `searcher`
+      within the string starting at the index `pos`. This is
+      preferable to the other overloads when the same needle
+      is searched for in many strings.
+
+      @par Complexity
+
+      Linear.
+
+      @note An empty string is always found.
+
+      @return The lowest index `idx` greater than or equal to `pos`
+      where the needle is equal to the `searcher.size()` characters
+      starting at `begin() + idx` if one exists, and @ref npos otherwise.
+
+      @param searcher The searcher for the string to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find(
+    const static_string_searcher<CharT, Traits>& searcher,
+    size_type pos = 0) const noexcept
+  {
+    const auto curr_size = size();
+    if (pos > curr_size || searcher.size() > curr_size - pos)
+      return npos;
+    if (!searcher.size())
+      return pos;
+    const auto res = searcher(data() + pos, data() + curr_size).first;
+    return res == end() ? npos : detail::distance(data(), res);
+  }
+
+
+  /** Find the last occurrence of a string within the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
+      the last occurrence of `sv` within the string starting before or at
+      the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return The highest index `idx` less than or equal to `pos`
+      where each element of `{sv.begin(), sv.end())` is equal to
+      that of `{begin() + idx, begin() + idx + count)` if one exists,
+      and @ref npos otherwise.
+
+      @param t The string to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is @ref npos.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  rfind(
+    const T& t,
+    size_type pos = npos) const
+#ifdef BOOST_STATIC_STRING_DOCS
+      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
+#else
+      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
+#endif
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return rfind(sv.data(), pos, sv.size());
+  }
+
+  /** Find the last occurrence of a string within the string.
+
+      Finds the last occurrence of `str` within the string
+      starting before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The highest index `idx` less than or equal to `pos`
+      where each element of `str` is equal to that
+      of `{begin() + idx, begin() + idx + str.size())`
+      if one exists, and @ref npos otherwise.
+
+      @param str The string to search for.
+      @param pos The index to start searching at. The default argument for
+      this parameter is @ref npos.
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  rfind(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos = npos) const noexcept
+  {
+    return rfind(str.data(), pos, str.size());
+  }
+
+  /** Find the last occurrence of a string within the string.
+
+      Finds the last occurrence of the string pointed to
+      by `s` within the string starting before or at
+      the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The highest index `idx` less than or equal to `pos`
+      where each element of `{s, s + n)` is equal to that of
+      `{begin() + idx, begin() + idx + n)` if one exists,
+      and @ref npos otherwise.
+
+      @param s The string to search for.
+      @param pos The index to start searching at.
+      @param n The length of the string to search for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  rfind(
+    const_pointer s,
+    size_type pos,
+    size_type n) const noexcept;
+
+  /** Find the last occurrence of a string within the string.
+
+      Finds the last occurrence of the string pointed to by `s`
+      of length `count` within the string starting before or at the
+      index `pos`, where `count` is `traits_type::length(s)`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The highest index `idx` less than or equal to `pos`
+      where each element of `{s, s + count)` is equal to that of
+      `{begin() + idx, begin() + idx + count)` if one exists,
+      and @ref npos otherwise.
+
+      @param s The string to search for.
+      @param pos The index to stop searching at. The default argument
+      for this parameter is @ref npos.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  rfind(
+    const_pointer s,
+    size_type pos = npos) const noexcept
+  {
+    return rfind(s, pos, traits_type::length(s));
+  }
+
+  /** Find the last occurrence of a character within the string.
+
+      Finds the last occurrence of `c` within the string
+      starting before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last occurrence of `c` within
+      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+
+      @param c The character to search for.
+      @param pos The index to stop searching at. The default argument
+      for this parameter is @ref npos.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  rfind(
+    value_type c,
+    size_type pos = npos) const noexcept
+  {
+    return rfind(&c, pos, 1);
+  }
+
+  /** Find the first occurrence of any of the characters within the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
+      the first occurrence of any of the characters in `sv`
+      within the string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return The index corrosponding to the first occurrence of
+      any of the characters in `{sv.begin(), sv.end())` within
+      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+
+      @param t The characters to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_of(
+    const T& t,
+    size_type pos = 0) const
+#ifdef BOOST_STATIC_STRING_DOCS
+      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
+#else
+      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
+#endif
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return find_first_of(sv.data(), pos, sv.size());
+  }
+
+  /** Find the first occurrence of any of the characters within the string.
+
+      Finds the first occurrence of any of the characters within `str` within the
+      string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first occurrence of any of the characters
+      of `str` within `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+
+      @param str The characters to search for.
+      @param pos The index to start searching at. The default argument for
+      this parameter is `0`.
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_of(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos = 0) const noexcept
+  {
+    return find_first_of(str.data(), pos, str.size());
+  }
+
+  /** Find the first occurrence of any of the characters within the string.
+
+      Finds the first occurrence of any of the characters within the string pointed to
+      by `s` within the string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first occurrence
+      of any of the characters in `{s, s + n)` within `{begin() + pos, end())`
+      if it exists, and @ref npos otherwise.
+
+      @param s The characters to search for.
+      @param pos The index to start searching at.
+      @param n The length of the string to search for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_of(
+    const_pointer s,
+    size_type pos,
+    size_type n) const noexcept;
+
+  /** Find the first occurrence of any of the characters within the string.
+
+      Finds the first occurrence of the any of the characters within string
+      pointed to by `s` of length `count` within the string starting at the
+      index `pos`, where `count` is `traits_type::length(s)`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first occurrence of any of
+      the characters in `{s, s + count)` within
+      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+
+      @param s The characters to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_of(
+    const_pointer s,
+    size_type pos = 0) const noexcept
+  {
+    return find_first_of(s, pos, traits_type::length(s));
+  }
+
+  /** Find the first occurrence of a character within the string.
+
+      Finds the first occurrence of `c` within the string
+      starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first occurrence of `c` within
+      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+
+      @param c The character to search for.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_of(
+    value_type c,
+    size_type pos = 0) const noexcept
+  {
+    return find_first_of(&c, pos, 1);
+  }
+
+  /** Find the last occurrence of any of the characters within the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
+      the last occurrence of any of the characters in `sv`
+      within the string before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return The index corrosponding to the last occurrence of
+      any of the characters in `{sv.begin(), sv.end())` within
+      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+
+      @param t The characters to search for.
+      @param pos The index to stop searching at. The default argument
+      for this parameter is @ref npos.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_of(
+    const T& t,
+    size_type pos = npos) const
+#ifdef BOOST_STATIC_STRING_DOCS
+      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
+#else
+      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
+#endif
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return find_last_of(sv.data(), pos, sv.size());
+  }
+
+  /** Find the last occurrence of any of the characters within the string.
+
+      Finds the last occurrence of any of the characters within `str` within the
+      string starting before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last occurrence of any of the characters
+      of `str` within `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+
+      @param str The characters to search for.
+      @param pos The index to stop searching at. The default argument for
+      this parameter is @ref npos.
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_of(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos = npos) const noexcept
+  {
+    return find_last_of(str.data(), pos, str.size());
+  }
+
+  /** Find the last occurrence of any of the characters within the string.
+
+      Finds the last occurrence of any of the characters within the string pointed to
+      by `s` within the string before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last occurrence
+      of any of the characters in `{s, s + n)` within `{begin(), begin() + pos}`
+      if it exists, and @ref npos otherwise.
+
+      @param s The characters to search for.
+      @param pos The index to stop searching at.
+      @param n The length of the string to search for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_of(
+    const_pointer s,
+    size_type pos,
+    size_type n) const noexcept;
+
+  /** Find the last occurrence of any of the characters within the string.
+
+      Finds the last occurrence of any of the characters within the string pointed to
+      by `s` of length `count` within the string before or at the index `pos`,
+      where `count` is `traits_type::length(s)`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last occurrence
+      of any of the characters in `{s, s + count)` within `{begin(), begin() + pos}`
+      if it exists, and @ref npos otherwise.
+
+      @param s The characters to search for.
+      @param pos The index to stop searching at. The default argument for
+      this parameter is @ref npos.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_of(
+    const_pointer s,
+    size_type pos = npos) const noexcept
+  {
+    return find_last_of(s, pos, traits_type::length(s));
+  }
+
+  /** Find the last occurrence of a character within the string.
+
+      Finds the last occurrence of `c` within the string
+      before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last occurrence of `c` within
+      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+
+      @param c The character to search for.
+      @param pos The index to stop searching at. The default argument
+      for this parameter is @ref npos.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_of(
+    value_type c,
+    size_type pos = npos) const noexcept
+  {
+    return find_last_of(&c, pos, 1);
+  }
+
+  /** Find the first occurrence of a character not within the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
+      the first character that is not within `sv`, starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return The index corrosponding to the first occurrence of
+      a character that is not in `{sv.begin(), sv.end())` within
+      `{begin() + pos, end())` if it exists, and @ref npos otherwise.
+
+      @param t The characters to ignore.
+      @param pos The index to start searching at. The default argument
+      for this parameter is `0`.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_not_of(
+    const T& t,
+    size_type pos = 0) const
+#ifdef BOOST_STATIC_STRING_DOCS
+      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
+#else
+      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
+#endif
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return find_first_not_of(sv.data(), pos, sv.size());
+  }
+
+  /** Find the first occurrence of any of the characters not within the string.
+
+      Finds the first occurrence of a character that is not within `str`
+      within the string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first character of `{begin() + pos, end())`
+      that is not within `str` if it exists, and @ref npos otherwise.
+
+      @param str The characters to ignore.
+      @param pos The index to start searching at. The default argument for
+      this parameter is `0`.
+  */
+  template<std::size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_not_of(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos = 0) const noexcept
+  {
+    return find_first_not_of(str.data(), pos, str.size());
+  }
+
+  /** Find the first occurrence of any of the characters not within the string.
+
+      Finds the first occurrence of a character that is not within the string
+      pointed to by `s` within the string starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first character of `{begin() + pos, end())`
+      that is not within `{s, s + n)` if it exists, and @ref npos otherwise.
+
+      @param s The characters to ignore.
+      @param pos The index to start searching at. The default argument for
+      this parameter is `0`.
+      @param n The length of the characters to ignore.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_not_of(
+    const_pointer s,
+    size_type pos,
+    size_type n) const noexcept;
+
+  /** Find the first occurrence of any of the characters not within the string.
+
+      Finds the first occurrence of a character that is not within the string
+      pointed to by `s` of length `count` within the string starting
+      at the index `pos`, where `count` is `traits_type::length(s)`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first character of `{begin() + pos, end())`
+      that is not within `{s, s + count)` if it exists, and @ref npos otherwise.
+
+      @param s The characters to ignore.
+      @param pos The index to start searching at. The default argument for
+      this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_not_of(
+    const_pointer s,
+    size_type pos = 0) const noexcept
+  {
+    return find_first_not_of(s, pos, traits_type::length(s));
+  }
+
+  /** Find the first occurrence of a character not equal to `c`.
+
+      Finds the first occurrence of a character that is not equal
+      to `c`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the first character of `{begin() + pos, end())`
+      that is not equal to `c` if it exists, and @ref npos otherwise.
+
+      @param c The character to ignore.
+      @param pos The index to start searching at. The default argument for
+      this parameter is `0`.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_first_not_of(
+    value_type c,
+    size_type pos = 0) const noexcept
+  {
+    return find_first_not_of(&c, pos, 1);
+  }
+
+  /** Find the last occurrence of a character not within the string.
+
+      Constructs a temporary `string_view_type` object `sv` from `t`, and finds
+      the last character that is not within `sv`, starting at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @tparam T The type of the object to convert.
+
+      @par Constraints
+
+      `std::is_convertible<const T&, string_view>::value &&
+      !std::is_convertible<const T&, const CharT*>::value &&
+      !std::is_convertible<const T&, const basic_static_string&>::value`.
+
+      @return The index corrosponding to the last occurrence of
+      a character that is not in `{sv.begin(), sv.end())` within
+      `{begin(), begin() + pos}` if it exists, and @ref npos otherwise.
+
+      @param t The characters to ignore.
+      @param pos The index to start searching at. The default argument
+      for this parameter is @ref npos.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_not_of(
+    const T& t,
+    size_type pos = npos) const
+#ifdef BOOST_STATIC_STRING_DOCS
+      noexcept(detail::is_nothrow_convertible<const T&, string_view_type>::value)
+#else
+      noexcept(detail::is_nothrow_convertible<const T&, detail::common_string_view_type<T, CharT, Traits>>::value)
+#endif
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    return find_last_not_of(sv.data(), pos, sv.size());
+  }
+
+  /** Find the last occurrence of a character not within the string.
+
+      Finds the last occurrence of a character that is not within `str`
+      within the string before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
+      that is not within `str` if it exists, and @ref npos otherwise.
+
+      @param str The characters to ignore.
+      @param pos The index to stop searching at. The default argument for
+      this parameter is @ref npos.
+  */
+  template<size_t M>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_not_of(
+    const basic_static_string<M, CharT, Traits, OverflowPolicy>& str,
+    size_type pos = npos) const noexcept
+  {
+    return find_last_not_of(str.data(), pos, str.size());
+  }
+
+  /** Find the last occurrence of a character not within the string.
+
+      Finds the last occurrence of a character that is not within the
+      string pointed to by `s` within the string before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
+      that is not within `{s, s + n)` if it exists, and @ref npos otherwise.
+
+      @param s The characters to ignore.
+      @param pos The index to stop searching at. The default argument for
+      this parameter is @ref npos.
+      @param n The length of the characters to ignore.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_not_of(
+    const_pointer s,
+    size_type pos,
+    size_type n) const noexcept;
+
+
+  /** Find the last occurrence of a character not within the string.
+
+      Finds the last occurrence of a character that is not within the
+      string pointed to by `s` of length `count` within the string
+      before or at the index `pos`, where `count` is `traits_type::length(s)`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
+      that is not within `{s, s + count)` if it exists, and @ref npos otherwise.
+
+      @param s The characters to ignore.
+      @param pos The index to stop searching at. The default argument for
+      this parameter is @ref npos.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_not_of(
+    const_pointer s,
+    size_type pos = npos) const noexcept
+  {
+    return find_last_not_of(s, pos, traits_type::length(s));
+  }
+
+  /** Find the last occurrence of a character not equal to `c`.
+
+      Finds the last occurrence of a character that is not equal
+      to `c` before or at the index `pos`.
+
+      @par Complexity
+
+      Linear.
+
+      @return The index corrosponding to the last character of `{begin(), begin() + pos}`
+      that is not equal to `c` if it exists, and @ref npos otherwise.
+
+      @param c The character to ignore.
+      @param pos The index to start searching at. The default argument for
+      this parameter is @ref npos.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  find_last_not_of(
+    value_type c,
+    size_type pos = npos) const noexcept
+  {
+    return find_last_not_of(&c, pos, 1);
+  }
+
+  /** Return whether the string begins with a string.
+
+      Returns `true` if the string begins with `s`, and `false` otherwise.
+
+      @par Complexity
+
+      Linear.
+
+      @param t The string view to check for.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+            , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  starts_with(
+    T const& t) const noexcept
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    const size_type len = sv.size();
+    return size() >= len && !traits_type::compare(data(), sv.data(), len);
+  }
+
+  /** Return whether the string begins with a character.
+
+      Returns `true` if the string begins with `c`, and `false` otherwise.
+
+      @par Complexity
+
+      Constant.
+
+      @param c The character to check for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  starts_with(
+    value_type c) const noexcept
+  {
+    return !empty() && traits_type::eq(front(), c);
+  }
+
+  /** Return whether the string begins with a string.
+
+      Returns `true` if the string begins with the string
+      pointed to be `s` of length `traits_type::length(s)`,
+      and `false` otherwise.
+
+      @par Complexity
+
+      Linear.
+
+      @param s The string to check for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  starts_with(
+    const_pointer s) const noexcept
+  {
+    const size_type len = traits_type::length(s);
+    return size() >= len && !traits_type::compare(data(), s, len);
+  }
+
+  /** Return whether the string ends with a string.
+
+      Returns `true` if the string ends with `s`, and `false` otherwise.
+
+      @par Complexity
+
+      Linear.
+
+      @param t The string view to check for.
+  */
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+            , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  ends_with(
+    T const& t) const noexcept
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    const size_type len = sv.size();
+    return size() >= len && !traits_type::compare(data() + (size() - len), sv.data(), len);
+  }
+
+  /** Return whether the string ends with a character.
+
+      Returns `true` if the string ends with `c`, and `false` otherwise.
+
+      @par Complexity
+
+      Constant.
+
+      @param c The character to check for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  ends_with(
+    value_type c) const noexcept
+  {
+    return !empty() && traits_type::eq(back(), c);
+  }
+
+  /** Return whether the string ends with a string.
+
+      Returns `true` if the string ends with the string
+      pointed to be `s` of length `traits_type::length(s)`,
+      and `false` otherwise.
+
+      @par Complexity
+
+      Linear.
+
+      @param s The string to check for.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  ends_with(
+    const_pointer s) const noexcept
+  {
+    const size_type len = traits_type::length(s);
+    return size() >= len && !traits_type::compare(data() + (size() - len), s, len);
+  }
+
+private:
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  term() noexcept
+  {
+    this->term_impl();
+    return *this;
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  assign_char(value_type ch, std::true_type) noexcept
+  {
+    this->set_size(1);
+    traits_type::assign(data()[0], ch);
+    return term();
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  assign_char(value_type, std::false_type)
+  {
+    report_overflow("max_size() == 0");
+    return *this;
+  }
+
+  // Reports an overflow to the policy, or asserts
+  // if the policy does not check
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  report_overflow(const char* msg)
+  {
+    report_overflow(msg, std::integral_constant<
+      bool, OverflowPolicy::checked>());
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  report_overflow(const char* msg, std::true_type)
+  {
+    overflow_policy().on_overflow(msg);
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  report_overflow(const char*, std::false_type) noexcept
+  {
+    BOOST_STATIC_STRING_ASSERT(!"capacity exceeded");
+  }
+
+  // Returns count if it is no greater than avail. Otherwise
+  // reports an overflow, and returns avail if the policy does
+  // not throw. Unchecked policies only assert.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  checked_count(size_type count, size_type avail, const char* msg)
+  {
+    return checked_count(count, avail, msg, std::integral_constant<
+      bool, OverflowPolicy::checked>());
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  checked_count(
+    size_type count, size_type avail, const char* msg, std::true_type)
+  {
+    if (count > avail)
+    {
+      overflow_policy().on_overflow(msg);
+      return avail;
+    }
+    return count;
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  checked_count(
+    size_type count, size_type avail, const char*, std::false_type) noexcept
+  {
+    BOOST_STATIC_STRING_ASSERT(count <= avail);
+    (void)avail;
+    return count;
+  }
+
+  // Returns the size of data read from input iterator. Read data begins at data() + size() + 1.
+  template<typename InputIterator>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  read_back(
+    bool overwrite_null,
+    InputIterator first,
+    InputIterator last);
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace_unchecked(
+    size_type pos,
+    size_type n1,
+    const_pointer s,
+    size_type n2)
+  {
+    if (pos > size())
+      detail::throw_exception<std::out_of_range>(
+        "pos > size()");
+    return replace_unchecked(data() + pos, data() + pos + capped_length(pos, n1), s, n2);
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  replace_unchecked(
+    const_iterator i1,
+    const_iterator i2,
+    const_pointer s,
+    size_type n2);
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  insert_unchecked(
+    size_type index,
+    const_pointer s,
+    size_type count)
+  {
+    if (index > size())
+      detail::throw_exception<std::out_of_range>(
+        "index > size()");
+    insert_unchecked(data() + index, s, count);
+    return *this;
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  iterator
+  insert_unchecked(
+    const_iterator pos,
+    const_pointer s,
+    size_type count);
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_static_string&
+  assign_unchecked(
+    const_pointer s,
+    size_type count) noexcept
+  {
+    this->set_size(count);
+    traits_type::copy(data(), s, size() + 1);
+    return *this;
+  }
+
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  capped_length(
+    size_type index,
+    size_type length) const
+  {
+    if (index > size())
+      detail::throw_exception<std::out_of_range>(
+        "index > size()");
+    return (std::min)(size() - index, length);
+  }
+
+  template<typename Float, typename... Args>
+  basic_static_string&
+  append_float_impl(
+    Float value,
+    Args... args)
+  {
+    const auto curr_size = size();
+    const std::size_t max_count =
+      std::numeric_limits<Float>::max_digits10 + 7;
+    if (max_size() - curr_size >= max_count)
+    {
+      const pointer first = end();
+      this->set_size(curr_size +
+        (detail::write_float(first, value, args...) - first));
+      return term();
+    }
+    value_type buffer[max_count];
+    return append(buffer,
+      detail::write_float(buffer, value, args...) - buffer);
+  }
+};
+
+//------------------------------------------------------------------------------
+//
+// Non-member functions
+//
+//------------------------------------------------------------------------------
 
 template<
   std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator==(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
+{
+  return detail::equal<Traits>(
+    lhs.data(), lhs.size(),
+    rhs.data(), rhs.size());
+}
+
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator!=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
+{
+  return !detail::equal<Traits>(
+    lhs.data(), lhs.size(),
+    rhs.data(), rhs.size());
+}
+
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhs.data(), rhs.size()) < 0;
+}
+
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhs.data(), rhs.size()) <= 0;
+}
+
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator>(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhs.data(), rhs.size()) > 0;
+}
+
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator>=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhs.data(), rhs.size()) >= 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator==(
+  const CharT* lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  return detail::equal<Traits>(
+    lhs, Traits::length(lhs),
+    rhs.data(), rhs.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator==(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const CharT* rhs)
+{
+  return detail::equal<Traits>(
+    lhs.data(), lhs.size(),
+    rhs, Traits::length(rhs));
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator==(
+  const T& lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
+  return detail::equal<Traits>(
+    lhsv.data(), lhsv.size(),
+    rhs.data(), rhs.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator==(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const T& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
+  return detail::equal<Traits>(
+    lhs.data(), lhs.size(),
+    rhsv.data(), rhsv.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator!=(
+  const CharT* lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  return !detail::equal<Traits>(
+    lhs, Traits::length(lhs),
+    rhs.data(), rhs.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator!=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const CharT* rhs)
+{
+  return !detail::equal<Traits>(
+    lhs.data(), lhs.size(),
+    rhs, Traits::length(rhs));
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator!=(
+  const T& lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
+  return !detail::equal<Traits>(
+    lhsv.data(), lhsv.size(),
+    rhs.data(), rhs.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator!=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const T& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
+  return !detail::equal<Traits>(
+    lhs.data(), lhs.size(),
+    rhsv.data(), rhsv.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<(
+  const CharT* lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs, Traits::length(lhs),
+    rhs.data(), rhs.size()) < 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const CharT* rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhs, Traits::length(rhs)) < 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<(
+  const T& lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhsv.data(), lhsv.size(),
+    rhs.data(), rhs.size()) < 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const T& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhsv.data(), rhsv.size()) < 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<=(
+  const CharT* lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs, Traits::length(lhs),
+    rhs.data(), rhs.size()) <= 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const CharT* rhs)
+{
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhs, Traits::length(rhs)) <= 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+bool
+operator<=(
+  const T& lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhsv.data(), lhsv.size(),
+    rhs.data(), rhs.size()) <= 0;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
+#endif
+    >
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator>=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
+operator<=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const T& rhs)
 {
-  return lhs.compare(rhs) >= 0;
+  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
+  return detail::lexicographical_compare<CharT, Traits>(
+    lhs.data(), lhs.size(),
+    rhsv.data(), rhsv.size()) <= 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator==(
+operator>(
   const CharT* lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
 {
   return detail::lexicographical_compare<CharT, Traits>(
     lhs, Traits::length(lhs),
-    rhs.data(), rhs.size()) == 0;
+    rhs.data(), rhs.size()) > 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator==(
-  const basic_static_string<N, CharT, Traits>& lhs,
+operator>(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
   const CharT* rhs)
 {
   return detail::lexicographical_compare<CharT, Traits>(
     lhs.data(), lhs.size(),
-    rhs, Traits::length(rhs)) == 0;
+    rhs, Traits::length(rhs)) > 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
 #ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
     >
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator==(
+operator>(
   const T& lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
 {
   detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
   return detail::lexicographical_compare<CharT, Traits>(
     lhsv.data(), lhsv.size(),
-    rhs.data(), rhs.size()) == 0;
+    rhs.data(), rhs.size()) > 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
 #ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
     >
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator==(
-  const basic_static_string<N, CharT, Traits>& lhs,
+operator>(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
   const T& rhs)
 {
   detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
   return detail::lexicographical_compare<CharT, Traits>(
     lhs.data(), lhs.size(),
-    rhsv.data(), rhsv.size()) == 0;
+    rhsv.data(), rhsv.size()) > 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator!=(
+operator>=(
   const CharT* lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
 {
   return detail::lexicographical_compare<CharT, Traits>(
     lhs, Traits::length(lhs),
-    rhs.data(), rhs.size()) != 0;
+    rhs.data(), rhs.size()) >= 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator!=(
-  const basic_static_string<N, CharT, Traits>& lhs,
+operator>=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
   const CharT* rhs)
 {
   return detail::lexicographical_compare<CharT, Traits>(
     lhs.data(), lhs.size(),
-    rhs, Traits::length(rhs)) != 0;
+    rhs, Traits::length(rhs)) >= 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
 #ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
     >
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator!=(
+operator>=(
   const T& lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
 {
   detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
   return detail::lexicographical_compare<CharT, Traits>(
     lhsv.data(), lhsv.size(),
-    rhs.data(), rhs.size()) != 0;
+    rhs.data(), rhs.size()) >= 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy, class T
 #ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
     >
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
 bool
-operator!=(
-  const basic_static_string<N, CharT, Traits>& lhs,
+operator>=(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
   const T& rhs)
 {
   detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
   return detail::lexicographical_compare<CharT, Traits>(
     lhs.data(), lhs.size(),
-    rhsv.data(), rhsv.size()) != 0;
+    rhsv.data(), rhsv.size()) >= 0;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+// The result has the overflow policy of lhs.
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy1, typename OverflowPolicy2>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
-bool
-operator<(
-  const CharT* lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+basic_static_string<N + M, CharT, Traits, OverflowPolicy1>
+operator+(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy1>& lhs,
+  const basic_static_string<M, CharT, Traits, OverflowPolicy2>& rhs)
 {
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs, Traits::length(lhs),
-    rhs.data(), rhs.size()) < 0;
+  return basic_static_string<N + M, CharT, Traits, OverflowPolicy1>(lhs).append(
+    rhs.data(), rhs.size());
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+basic_static_string<N + 1, CharT, Traits, OverflowPolicy>
+operator+(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  CharT rhs)
+{
+  return basic_static_string<N + 1, CharT, Traits, OverflowPolicy>(lhs) += rhs;
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+basic_static_string<N + 1, CharT, Traits, OverflowPolicy>
+operator+(
+  CharT lhs,
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
+{
+  // The cast to std::size_t is needed here since 0 is a null pointer constant
+  return basic_static_string<N + 1, CharT, Traits, OverflowPolicy>(rhs).insert(
+    std::size_t(0), 1, lhs);
+}
+
+// Add a null terminated character array to a string.
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+basic_static_string<N + M, CharT, Traits, OverflowPolicy>
+operator+(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  const CharT(&rhs)[M])
+{
+  return basic_static_string<N + M, CharT, Traits, OverflowPolicy>(lhs).append(+rhs);
+}
+
+// Add a string to a null terminated character array.
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+basic_static_string<N + M, CharT, Traits, OverflowPolicy>
+operator+(
+  const CharT(&lhs)[N],
+  const basic_static_string<M, CharT, Traits, OverflowPolicy>& rhs)
+{
+  // The cast to std::size_t is needed here since 0 is a null pointer constant
+  return basic_static_string<N + M, CharT, Traits, OverflowPolicy>(rhs).insert(
+    std::size_t(0), +lhs);
+}
+
+//------------------------------------------------------------------------------
+//
+// concat
+//
+//------------------------------------------------------------------------------
+
+/** Concatenate strings.
+
+    Returns a string holding the concatenation of
+    `pieces`. Unlike a chain of `operator+`, the total
+    size is computed once and each piece is copied once,
+    directly into the result, without building the
+    intermediate strings.
+
+    Each piece may be a `basic_static_string`, a
+    null-terminated character array, a single character of
+    exactly the type `CharT`, an object convertible to
+    `const CharT*`, or an object with `data` and `size`
+    member functions. The character type and traits of the
+    result are those of the first piece which is a
+    `basic_static_string` or a character array.
+
+    @par Example
+
+    @code
+    static_string<64> path = concat<64>(dir, '/', name, ".txt");
+    @endcode
+
+    @par Complexity
+
+    Linear in the size of the result.
+
+    @tparam N The capacity of the result.
+
+    @return The concatenation of `pieces`.
+
+    @param pieces The pieces to concatenate.
+
+    @throw std::length_error if the result would
+    exceed `N` characters
+*/
+template<std::size_t N, typename... Pieces
+#ifndef BOOST_STATIC_STRING_DOCS
+  , typename Result = detail::concat_result<Pieces...>
+  , typename = typename std::enable_if<
+      !std::is_void<typename Result::char_type>::value>::type
+#endif
+>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+basic_static_string<N,
+  typename Result::char_type,
+  typename Result::traits_type>
+concat(const Pieces&... pieces)
+{
+  return detail::concat_impl<N,
+    typename Result::char_type,
+    typename Result::traits_type>(pieces...);
+}
+
+/** Concatenate strings.
+
+    Returns a string holding the concatenation of
+    `pieces`, whose capacity is the sum of the capacities
+    of the pieces. Unlike a chain of `operator+`, the total
+    size is computed once and each piece is copied once,
+    directly into the result, without building the
+    intermediate strings.
+
+    Each piece may be a `basic_static_string`, a
+    null-terminated character array, or a single character
+    of exactly the type `CharT`, so the capacity is known
+    from the types alone. The character type and traits of
+    the result are those of the first piece which is a
+    `basic_static_string` or a character array.
+
+    @par Example
+
+    @code
+    auto s = concat(a, ", ", b, '!');
+    @endcode
+
+    @par Complexity
+
+    Linear in the size of the result.
+
+    @return The concatenation of `pieces`.
+
+    @param pieces The pieces to concatenate.
+*/
+template<typename... Pieces
+#ifndef BOOST_STATIC_STRING_DOCS
+  , typename Result = detail::concat_result<Pieces...>
+  , typename = typename std::enable_if<
+      !std::is_void<typename Result::char_type>::value &&
+      Result::fixed>::type
+#endif
+>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+basic_static_string<Result::capacity,
+  typename Result::char_type,
+  typename Result::traits_type>
+concat(const Pieces&... pieces)
+{
+  return detail::concat_impl<Result::capacity,
+    typename Result::char_type,
+    typename Result::traits_type>(pieces...);
+}
+
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+//------------------------------------------------------------------------------
+//
+// split and join
+//
+//------------------------------------------------------------------------------
+
+/** A lazy range of the fields of a string.
+
+    The elements of the range are views of the fields of a
+    string which are separated by a delimiter, in order.
+    Consecutive delimiters produce empty fields, and a string
+    without any delimiter is a single field, so an empty
+    string has one empty field. No characters are copied;
+    the views refer to the characters of the source string.
+
+    The delimiters are found with the same routines as
+    @ref basic_static_string::find, which examine many
+    characters at once on most platforms.
+
+    @note The range and its iterators refer to the source
+    string, which must outlive them and the views obtained
+    from them. The iterators do not refer to the range.
+
+    @see split, join
+*/
+template<typename CharT,
+  typename Traits = std::char_traits<CharT>>
+class basic_split_view
+{
+public:
+  /// The type of the fields.
+  using value_type = basic_string_view<CharT, Traits>;
+
+  class iterator;
+
+  /** The delimiter of the fields.
+
+      Either a single character or a non-empty string,
+      which is not copied.
+  */
+  class delimiter
+  {
+    friend class iterator;
+
+    const CharT* data_;
+    std::size_t size_;
+    CharT ch_;
+
+  public:
+    /// Construct a delimiter from a character.
+    BOOST_STATIC_STRING_CPP11_CONSTEXPR
+    delimiter(CharT ch) noexcept
+      : data_(nullptr), size_(1), ch_(ch)
+    {
+    }
+
+    /// Construct a delimiter from a null-terminated string.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    delimiter(const CharT* s) noexcept
+      : data_(s), size_(Traits::length(s)), ch_()
+    {
+      BOOST_STATIC_STRING_ASSERT(size_ != 0);
+    }
+
+    /// Construct a delimiter from an object convertible to a view.
+    template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+      , typename = typename std::enable_if<
+          std::is_convertible<const T&, value_type>::value &&
+          !std::is_convertible<const T&, const CharT*>::value>::type
+#endif
+    >
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    delimiter(const T& t) noexcept(
+      detail::is_nothrow_convertible<const T&, value_type>::value)
+      : data_(nullptr), size_(0), ch_()
+    {
+      const value_type sv = t;
+      data_ = sv.data();
+      size_ = sv.size();
+      BOOST_STATIC_STRING_ASSERT(size_ != 0);
+    }
+  };
+
+  /// A forward iterator over the fields.
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename basic_split_view::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+  private:
+    friend class basic_split_view;
+
+    const CharT* last_ = nullptr;
+    delimiter delim_ = CharT();
+    value_type field_;
+    bool done_ = true;
+
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    iterator(
+      const CharT* first,
+      const CharT* last,
+      delimiter delim) noexcept
+      : last_(last)
+      , delim_(delim)
+      , field_(first, find(first) - first)
+      , done_(false)
+    {
+    }
+
+    // Returns the position of the next delimiter
+    // at or after first, or last_ if there is none.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    const CharT*
+    find(const CharT* first) const noexcept
+    {
+      if (delim_.size_ > std::size_t(last_ - first))
+        return last_;
+      return detail::search_chars<Traits>(first, last_,
+        delim_.data_ ? delim_.data_ : &delim_.ch_, delim_.size_);
+    }
+
+  public:
+    /// Construct a past-the-end iterator.
+    iterator() = default;
+
+    /// Return the current field.
+    BOOST_STATIC_STRING_CPP11_CONSTEXPR
+    reference
+    operator*() const noexcept
+    {
+      return field_;
+    }
+
+    /// Return a pointer to the current field.
+    BOOST_STATIC_STRING_CPP11_CONSTEXPR
+    pointer
+    operator->() const noexcept
+    {
+      return &field_;
+    }
+
+    /// Advance to the next field.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    iterator&
+    operator++() noexcept
+    {
+      const CharT* const last = field_.data() + field_.size();
+      if (last == last_)
+        *this = iterator();
+      else
+        field_ = value_type(last + delim_.size_,
+          find(last + delim_.size_) - (last + delim_.size_));
+      return *this;
+    }
+
+    /// Advance to the next field.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    iterator
+    operator++(int) noexcept
+    {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    /// Return whether two iterators refer to the same field.
+    friend
+    BOOST_STATIC_STRING_CPP11_CONSTEXPR
+    bool
+    operator==(
+      const iterator& lhs,
+      const iterator& rhs) noexcept
+    {
+      return lhs.done_ == rhs.done_ &&
+        lhs.field_.data() == rhs.field_.data();
+    }
+
+    /// Return whether two iterators refer to different fields.
+    friend
+    BOOST_STATIC_STRING_CPP11_CONSTEXPR
+    bool
+    operator!=(
+      const iterator& lhs,
+      const iterator& rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+  };
+
+  /// The type of iterator.
+  using const_iterator = iterator;
+
+  /** Constructor.
+
+      Construct a range of the fields of `{s, s + count)`.
+
+      @param s The characters to split.
+      @param count The number of characters.
+      @param delim The delimiter of the fields.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  basic_split_view(
+    const CharT* s,
+    std::size_t count,
+    delimiter delim) noexcept
+    : first_(s), last_(s + count), delim_(delim)
+  {
+  }
+
+  /// Return an iterator to the first field.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  iterator
+  begin() const noexcept
+  {
+    return iterator(first_, last_, delim_);
+  }
+
+  /// Return an iterator past the last field.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  iterator
+  end() const noexcept
+  {
+    return iterator();
+  }
+
+private:
+  const CharT* first_;
+  const CharT* last_;
+  delimiter delim_;
+};
+
+/** Split a string into fields.
+
+    Returns a lazy range of views of the fields of
+    `str` which are separated by `delim`.
+
+    @par Example
+
+    @code
+    static_string<512> record = "id,name,,price";
+    for (auto field : split(record, ','))
+      consume(field);
+    @endcode
+
+    @par Complexity
+
+    Linear in `str.size()` over a full iteration.
+
+    @return A @ref basic_split_view of the fields.
+
+    @param str The string to split, which must outlive the result.
+    @param delim The delimiter, either a character or a
+    non-empty string, which must outlive the result.
+*/
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+basic_split_view<CharT, Traits>
+split(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& str,
+  typename basic_split_view<CharT, Traits>::delimiter delim) noexcept
+{
+  return basic_split_view<CharT, Traits>(
+    str.data(), str.size(), delim);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
+#ifndef BOOST_STATIC_STRING_DOCS
+// The fields would refer to a destroyed string
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+void
+split(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>&&,
+  typename basic_split_view<CharT, Traits>::delimiter) = delete;
+#endif
+
+/** Join strings with a separator.
+
+    Returns a string holding the elements of `range`
+    separated by `sep`. The size of the result is computed
+    in a first pass over `range`, then each element and
+    separator is copied once, directly into the result.
+
+    The elements may be `basic_static_string` objects,
+    string views, null-terminated strings, characters of
+    exactly the type `CharT`, or other objects with `data`
+    and `size` member functions.
+
+    @par Example
+
+    @code
+    static_string<512> line = join<512>(split(record, ','), ';');
+    @endcode
+
+    @par Complexity
+
+    Linear in the size of the result.
+
+    @tparam N The capacity of the result.
+
+    @tparam Range A forward range.
+
+    @return The joined string.
+
+    @param range The strings to join.
+    @param sep The separator.
+
+    @throw std::length_error if the result would
+    exceed `N` characters
+*/
+template<std::size_t N, typename Range, typename CharT
+#ifndef BOOST_STATIC_STRING_DOCS
+  , typename = typename std::enable_if<
+      std::is_integral<CharT>::value>::type
+#endif
+>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 inline
-bool
-operator<(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const CharT* rhs)
+basic_static_string<N, CharT, std::char_traits<CharT>>
+join(
+  const Range& range,
+  CharT sep)
 {
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhs, Traits::length(rhs)) < 0;
+  return detail::join_impl<N, CharT, std::char_traits<CharT>>(
+    range, &sep, 1);
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
-#ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
+/** Join strings with a separator.
+
+    Returns a string holding the elements of `range`
+    separated by the null-terminated string `sep`.
+
+    @see join
+
+    @tparam N The capacity of the result.
+
+    @tparam Range A forward range.
+
+    @return The joined string.
+
+    @param range The strings to join.
+    @param sep The separator.
+
+    @throw std::length_error if the result would
+    exceed `N` characters
+*/
+template<std::size_t N, typename Range, typename CharT>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 inline
-bool
-operator<(
-  const T& lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+basic_static_string<N, CharT, std::char_traits<CharT>>
+join(
+  const Range& range,
+  const CharT* sep)
 {
-  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhsv.data(), lhsv.size(),
-    rhs.data(), rhs.size()) < 0;
+  return detail::join_impl<N, CharT, std::char_traits<CharT>>(
+    range, sep, std::char_traits<CharT>::length(sep));
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
-#ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
+/** Join strings with a separator.
+
+    Returns a string holding the elements of `range`
+    separated by `sep`.
+
+    @see join
+
+    @tparam N The capacity of the result.
+
+    @tparam Range A forward range.
+
+    @return The joined string.
+
+    @param range The strings to join.
+    @param sep The separator.
+
+    @throw std::length_error if the result would
+    exceed `N` characters
+*/
+template<std::size_t N, typename Range,
+  typename CharT, typename Traits>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 inline
-bool
-operator<(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const T& rhs)
+basic_static_string<N, CharT, Traits>
+join(
+  const Range& range,
+  basic_string_view<CharT, Traits> sep)
 {
-  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhsv.data(), rhsv.size()) < 0;
+  return detail::join_impl<N, CharT, Traits>(
+    range, sep.data(), sep.size());
 }
+#endif
 
-template<std::size_t N, typename CharT, typename Traits>
+//------------------------------------------------------------------------------
+//
+// erase_if
+//
+//------------------------------------------------------------------------------
+
+template<
+    std::size_t N, typename CharT,
+    typename Traits, typename OverflowPolicy,
+    typename UnaryPredicate>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator<=(
-  const CharT* lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+typename
+basic_static_string<N, CharT, Traits, OverflowPolicy>::size_type
+erase_if(
+    basic_static_string<N, CharT, Traits, OverflowPolicy>& str,
+    UnaryPredicate pred)
 {
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs, Traits::length(lhs),
-    rhs.data(), rhs.size()) <= 0;
+  auto first = str.begin();
+  for (auto it = first; it != str.end(); ++it)
+    if (!pred(*it))
+      *first++ = std::move(*it);
+  const auto count = str.end() - first;
+  str.erase(first, str.end());
+  return count;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+//------------------------------------------------------------------------------
+//
+// swap
+//
+//------------------------------------------------------------------------------
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
-bool
-operator<=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const CharT* rhs)
+void
+swap(
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& rhs)
 {
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhs, Traits::length(rhs)) <= 0;
+  lhs.swap(rhs);
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
-#ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-    >
+template<
+  std::size_t N, std::size_t M,
+  typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 inline
-bool
-operator<=(
-  const T& lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
+void
+swap(
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& lhs,
+  basic_static_string<M, CharT, Traits, OverflowPolicy>& rhs)
 {
-  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhsv.data(), lhsv.size(),
-    rhs.data(), rhs.size()) <= 0;
+  lhs.swap(rhs);
 }
 
-template<std::size_t N, typename CharT, typename Traits, class T
-#ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator<=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const T& rhs)
-{
-  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhsv.data(), rhsv.size()) <= 0;
-}
+//------------------------------------------------------------------------------
+//
+// Builder
+//
+//------------------------------------------------------------------------------
+
+/** A scoped handle which appends to a string without checks.
+
+    Appends to a @ref basic_static_string through a write
+    cursor. The appending functions do not check the
+    capacity, and the size and null terminator of the
+    string are only written when @ref commit is called
+    or the builder is destroyed. This suits code which
+    proves once that the characters fit, for example by
+    summing the lengths of the fields against
+    @ref available, and then performs many appends.
+
+    For @ref push_back and the `append` overloads taking
+    characters or strings, exceeding the capacity is a
+    precondition violation, which is only checked by
+    assertions. Until the builder is committed, the string
+    must not be accessed other than through the builder.
+
+    Appending a range, and the iterator returned by
+    @ref back_inserter, check the capacity and report an
+    overflow through the overflow policy of the string.
+    A range of forward iterators is checked once, while
+    the iterator compares the cursor against the end of
+    the storage for each character. This replaces
+    `std::back_inserter` when a string is produced one
+    character at a time, for example by a decoder whose
+    output length is not known up front: `push_back` on
+    the string also updates the size and writes the
+    terminator each time.
+
+    @par Example
+
+    @code
+    static_string<64> line = "GET ";
+    if (path.size() + 9 <= line.max_size() - line.size())
+    {
+      static_string_builder<64> b(line);
+      b.append(path);
+      b.append(" HTTP/1.1");
+    } // line is committed here
+    @endcode
+
+    @tparam N The capacity of the string.
+    @tparam CharT The character type.
+    @tparam Traits The traits type.
+    @tparam OverflowPolicy The overflow policy of the string.
+*/
+template<std::size_t N, typename CharT,
+  typename Traits = std::char_traits<CharT>,
+  typename OverflowPolicy = throw_on_overflow>
+class basic_static_string_builder
+{
+public:
+  /// The type of string being built.
+  using string_type =
+    basic_static_string<N, CharT, Traits, OverflowPolicy>;
+
+  /// The traits type.
+  using traits_type = Traits;
+
+  /// The character type.
+  using value_type = typename traits_type::char_type;
+
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// The constant pointer type.
+  using const_pointer = const value_type*;
+
+  /** An output iterator which appends to a builder.
+
+      Assigning a character through the iterator appends
+      it to the builder. If the string is full, an overflow
+      is reported through its overflow policy, and the
+      character is discarded if the policy returns.
+  */
+  class back_insert_iterator
+  {
+  public:
+    /// The iterator category.
+    using iterator_category = std::output_iterator_tag;
+
+    /// The value type.
+    using value_type = void;
+
+    /// The difference type.
+    using difference_type = std::ptrdiff_t;
+
+    /// The pointer type.
+    using pointer = void;
+
+    /// The reference type.
+    using reference = void;
+
+    /// Constructor.
+    BOOST_STATIC_STRING_CPP11_CONSTEXPR
+    explicit
+    back_insert_iterator(basic_static_string_builder& b) noexcept
+      : b_(&b)
+    {
+    }
+
+    /** Append a character.
+
+        @throw std::length_error `available() == 0` for
+        the builder, with the default overflow policy.
+    */
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    back_insert_iterator&
+    operator=(
+      typename basic_static_string_builder::value_type ch)
+    {
+      b_->checked_push_back(ch);
+      return *this;
+    }
+
+    /// Return `*this`.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    back_insert_iterator&
+    operator*() noexcept
+    {
+      return *this;
+    }
+
+    /// Return `*this`.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    back_insert_iterator&
+    operator++() noexcept
+    {
+      return *this;
+    }
+
+    /// Return `*this`.
+    BOOST_STATIC_STRING_CPP14_CONSTEXPR
+    back_insert_iterator
+    operator++(int) noexcept
+    {
+      return *this;
+    }
+
+  private:
+    basic_static_string_builder* b_;
+  };
+
+  /** Constructor.
+
+      Construct a builder which appends to `s`,
+      starting at the end of its current contents.
+
+      @param s The string to append to, which must
+      outlive the builder.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  explicit
+  basic_static_string_builder(string_type& s) noexcept
+    : str_(s)
+    , cursor_(s.data() + s.size())
+  {
+  }
+
+  basic_static_string_builder(
+    const basic_static_string_builder&) = delete;
+
+  basic_static_string_builder&
+  operator=(const basic_static_string_builder&) = delete;
+
+  /** Destructor.
+
+      Commits the characters written to the string.
+  */
+  BOOST_STATIC_STRING_CPP20_CONSTEXPR
+  ~basic_static_string_builder()
+  {
+    commit();
+  }
+
+  /// Return the size the string will have once committed.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  size() const noexcept
+  {
+    return cursor_ - str_.data();
+  }
+
+  /// Return the number of characters which can still be appended.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  size_type
+  available() const noexcept
+  {
+    return N - size();
+  }
+
+  /** Discard the contents of the string.
+
+      Moves the write cursor to the beginning of the
+      string, so that the characters appended afterwards
+      replace its contents.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  clear() noexcept
+  {
+    cursor_ = str_.data();
+  }
+
+  /** Append a character.
+
+      @par Precondition
+
+      `available() >= 1`
+
+      @param ch The character to append.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  push_back(value_type ch) noexcept
+  {
+    BOOST_STATIC_STRING_ASSERT(available() >= 1);
+    traits_type::assign(*cursor_++, ch);
+  }
+
+  /** Append copies of a character.
+
+      @par Precondition
+
+      `available() >= count`
+
+      @param count The number of characters to append.
+      @param ch The character to append.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append(
+    size_type count,
+    value_type ch) noexcept
+  {
+    BOOST_STATIC_STRING_ASSERT(available() >= count);
+    traits_type::assign(cursor_, count, ch);
+    cursor_ += count;
+  }
+
+  /** Append characters.
+
+      Appends the characters in the range `{s, s + count)`,
+      which may be part of the characters already written.
+
+      @par Precondition
+
+      `available() >= count`
+
+      @param s The characters to append.
+      @param count The number of characters to append.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append(
+    const_pointer s,
+    size_type count) noexcept
+  {
+    BOOST_STATIC_STRING_ASSERT(available() >= count);
+    traits_type::copy(cursor_, s, count);
+    cursor_ += count;
+  }
+
+  /** Append a null-terminated string.
+
+      @par Precondition
+
+      `available() >= traits_type::length(s)`
+
+      @param s The string to append.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append(const_pointer s) noexcept
+  {
+    append(s, traits_type::length(s));
+  }
+
+  /** Append a string.
+
+      @par Precondition
+
+      `available() >= s.size()`
+
+      @param s The string to append.
+  */
+  template<std::size_t M, typename OtherPolicy>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append(
+    const basic_static_string<M, CharT, Traits, OtherPolicy>& s) noexcept
+  {
+    append(s.data(), s.size());
+  }
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>(
-  const CharT* lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
-{
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs, Traits::length(lhs),
-    rhs.data(), rhs.size()) > 0;
-}
+  /** Append a string view.
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const CharT* rhs)
-{
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhs, Traits::length(rhs)) > 0;
-}
+      Appends `sv`, where `sv` is `string_view_type(t)`.
 
-template<std::size_t N, typename CharT, typename Traits, class T
-#ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>(
-  const T& lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
-{
-  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhsv.data(), lhsv.size(),
-    rhs.data(), rhs.size()) > 0;
-}
+      @par Precondition
 
-template<std::size_t N, typename CharT, typename Traits, class T
-#ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
-#endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const T& rhs)
-{
-  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhsv.data(), rhsv.size()) > 0;
-}
+      `available() >= sv.size()`
 
+      @tparam T The type of the object to convert.
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>=(
-  const CharT* lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
-{
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs, Traits::length(lhs),
-    rhs.data(), rhs.size()) >= 0;
-}
+      @par Constraints
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const CharT* rhs)
-{
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhs, Traits::length(rhs)) >= 0;
-}
+      @code
+      std::is_convertible<T const&, string_view>::value &&
+      !std::is_convertible<T const&, char const*>::value &&
+      !std::is_convertible<const T&, const string_type&>::value
+      @endcode
 
-template<std::size_t N, typename CharT, typename Traits, class T
+      @param t The string to append.
+  */
+  template<typename T
 #ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename = detail::enable_if_viewable_t<N, T, CharT, Traits, OverflowPolicy>
 #endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>=(
-  const T& lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
-{
-  detail::common_string_view_type<T, CharT, Traits> lhsv = lhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhsv.data(), lhsv.size(),
-    rhs.data(), rhs.size()) >= 0;
-}
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append(const T& t) noexcept
+  {
+    detail::common_string_view_type<T, CharT, Traits> sv = t;
+    append(sv.data(), sv.size());
+  }
+
+  /** Append a range of characters.
+
+      Appends the characters in the range `{first, last)`.
+      For forward iterators, the capacity is checked once
+      for the whole range rather than once per character.
+      If the range does not fit, an overflow is reported
+      through the overflow policy of the string, and the
+      characters which fit are appended if it returns.
+
+      @tparam InputIterator The type of the iterators.
+
+      @par Constraints
+
+      `InputIterator` satisfies __InputIterator__.
+
+      @param first An iterator to the first character to append.
+      @param last An iterator past the last character to append.
 
-template<std::size_t N, typename CharT, typename Traits, class T
+      @throw std::length_error `std::distance(first, last) > available()`,
+      with the default overflow policy.
+  */
+  template<typename InputIterator
 #ifndef BOOST_STATIC_STRING_DOCS
-      , typename = detail::enable_if_viewable_t<N, T, CharT, Traits>
+    , typename std::enable_if<
+      detail::is_input_iterator<InputIterator>
+        ::value>::type* = nullptr
 #endif
-    >
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-bool
-operator>=(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const T& rhs)
-{
-  detail::common_string_view_type<T, CharT, Traits> rhsv = rhs;
-  return detail::lexicographical_compare<CharT, Traits>(
-    lhs.data(), lhs.size(),
-    rhsv.data(), rhsv.size()) >= 0;
-}
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append(
+    InputIterator first,
+    InputIterator last)
+  {
+    append_range(first, last,
+      detail::is_forward_iterator<InputIterator>());
+  }
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-basic_static_string<N + M, CharT, Traits>
-operator+(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  return basic_static_string<N + M, CharT, Traits>(lhs) += rhs;
-}
+  /** Return an output iterator which appends to the builder.
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-basic_static_string<N + 1, CharT, Traits>
-operator+(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  CharT rhs)
-{
-  return basic_static_string<N + 1, CharT, Traits>(lhs) += rhs;
-}
+      The iterator checks the capacity for each character,
+      so the length of the output need not be known before
+      writing it.
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-basic_static_string<N + 1, CharT, Traits>
-operator+(
-  CharT lhs,
-  const basic_static_string<N, CharT, Traits>& rhs)
-{
-  // The cast to std::size_t is needed here since 0 is a null pointer constant
-  return basic_static_string<N + 1, CharT, Traits>(rhs).insert(
-    std::size_t(0), 1, lhs);
-}
+      @par Example
 
-// Add a null terminated character array to a string.
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-basic_static_string<N + M, CharT, Traits>
-operator+(
-  const basic_static_string<N, CharT, Traits>& lhs,
-  const CharT(&rhs)[M])
-{
-  return basic_static_string<N + M, CharT, Traits>(lhs).append(+rhs);
-}
+      @code
+      static_string<256> out;
+      {
+        static_string_builder<256> b(out);
+        decode(in, b.back_inserter());
+      }
+      @endcode
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  back_insert_iterator
+  back_inserter() noexcept
+  {
+    return back_insert_iterator(*this);
+  }
 
-// Add a string to a null terminated character array.
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-basic_static_string<N + M, CharT, Traits>
-operator+(
-  const CharT(&lhs)[N],
-  const basic_static_string<M, CharT, Traits>& rhs)
-{
-  // The cast to std::size_t is needed here since 0 is a null pointer constant
-  return basic_static_string<N + M, CharT, Traits>(rhs).insert(
-    std::size_t(0), +lhs);
-}
+  /** Commit the characters written to the string.
 
-//------------------------------------------------------------------------------
-//
-// erase_if
-//
-//------------------------------------------------------------------------------
+      Sets the size of the string and writes its null
+      terminator. The builder remains usable, and may
+      be committed again.
 
-template<
-    std::size_t N, typename CharT,
-    typename Traits, typename UnaryPredicate>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-typename
-basic_static_string<N, CharT, Traits>::size_type
-erase_if(
-    basic_static_string<N, CharT, Traits>& str,
-    UnaryPredicate pred)
-{
-  auto first = str.begin();
-  for (auto it = first; it != str.end(); ++it)
-    if (!pred(*it))
-      *first++ = std::move(*it);
-  const auto count = str.end() - first;
-  str.erase(first, str.end());
-  return count;
-}
+      @return The string.
+  */
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  string_type&
+  commit() noexcept
+  {
+    detail::string_access::set_size(str_, size());
+    return str_;
+  }
+
+private:
+  template<typename ForwardIterator>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append_range(
+    ForwardIterator first,
+    ForwardIterator last,
+    std::true_type)
+  {
+    const std::size_t n = detail::distance(first, last);
+    const std::size_t count = detail::string_access::checked_count(
+      str_, n, available(), "count > available()");
+    if (count != n)
+    {
+      last = first;
+      std::advance(last, count);
+    }
+    detail::copy_with_traits<Traits>(first, last, cursor_);
+    cursor_ += count;
+  }
+
+  template<typename InputIterator>
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  void
+  append_range(
+    InputIterator first,
+    InputIterator last,
+    std::false_type)
+  {
+    for (; first != last; ++first)
+    {
+      if (!checked_push_back(*first))
+        return;
+    }
+  }
+
+  // Appends ch if the string is not full. Otherwise
+  // reports an overflow, and returns false if the
+  // policy returns.
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  checked_push_back(value_type ch)
+  {
+    if (cursor_ == str_.data() + N)
+    {
+      detail::string_access::report_overflow(
+        str_, "available() == 0");
+      return false;
+    }
+    traits_type::assign(*cursor_++, ch);
+    return true;
+  }
 
-//------------------------------------------------------------------------------
-//
-// swap
-//
-//------------------------------------------------------------------------------
+  string_type& str_;
+  value_type* cursor_;
+};
 
-template<std::size_t N, typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-void
-swap(
-  basic_static_string<N, CharT, Traits>& lhs,
-  basic_static_string<N, CharT, Traits>& rhs)
-{
-  lhs.swap(rhs);
-}
+/// A builder which appends to a `static_string`.
+template<std::size_t N>
+using static_string_builder = basic_static_string_builder<N, char>;
 
-template<
-  std::size_t N, std::size_t M,
-  typename CharT, typename Traits>
-BOOST_STATIC_STRING_CPP14_CONSTEXPR
-inline
-void
-swap(
-  basic_static_string<N, CharT, Traits>& lhs,
-  basic_static_string<M, CharT, Traits>& rhs)
-{
-  lhs.swap(rhs);
-}
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+/// A builder which appends to a `static_wstring`.
+template<std::size_t N>
+using static_wstring_builder = basic_static_string_builder<N, wchar_t>;
+#endif
 
 //------------------------------------------------------------------------------
 //
@@ -6120,12 +11693,13 @@ swap(
 //
 //------------------------------------------------------------------------------
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 inline
 std::basic_ostream<CharT, Traits>&
 operator<<(
   std::basic_ostream<CharT, Traits>& os,
-  const basic_static_string<N, CharT, Traits>& s)
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& s)
 {
 #ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
   return os << basic_string_view<CharT, Traits>(s.data(), s.size());
@@ -6136,6 +11710,524 @@ operator<<(
 #endif
 }
 
+/** Extract a string from a stream.
+
+    Skips leading whitespace, then extracts characters into
+    `str` until a whitespace character is found, the input
+    ends, `is.width()` characters are extracted if it is
+    positive, or `str` is full. The characters are scanned
+    and copied directly from the buffer of the stream.
+    Sets `is.width(0)`.
+
+    Sets `failbit` if no characters are extracted, or if
+    `str` becomes full before the end of the word. If the
+    stream buffer throws, sets `badbit`, and rethrows the
+    exception if `badbit` is set in `is.exceptions()`.
+
+    @return `is`
+
+    @param is The stream to extract from.
+    @param str The string to store the characters in.
+*/
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+inline
+std::basic_istream<CharT, Traits>&
+operator>>(
+  std::basic_istream<CharT, Traits>& is,
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& str)
+{
+  typename std::basic_istream<CharT, Traits>::sentry se(is);
+  if (!se)
+    return is;
+  str.clear();
+  const std::streamsize width = is.width();
+  const std::size_t limit = width > 0 ?
+    (std::min)(std::size_t(width), N) : N;
+  const auto& ct = std::use_facet<std::ctype<CharT>>(is.getloc());
+  is.width(0);
+  detail::guarded_extract(is, [&]() -> std::ios_base::iostate
+  {
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    detail::read_until(*is.rdbuf(), str, state,
+      [&](const CharT* first, const CharT* last)
+      {
+        // never take more than limit characters
+        const std::size_t room = limit - str.size();
+        if (std::size_t(last - first) > room)
+          last = first + room;
+        return ct.scan_is(std::ctype_base::space, first, last);
+      });
+    // a full string which is not limited by the width
+    // fails unless the word ends after it
+    if (str.size() == N && (width <= 0 || std::size_t(width) > N) &&
+        !(state & std::ios_base::eofbit))
+    {
+      const auto c = is.rdbuf()->sgetc();
+      if (Traits::eq_int_type(c, Traits::eof()))
+        state |= std::ios_base::eofbit;
+      else if (!ct.is(std::ctype_base::space, Traits::to_char_type(c)))
+        state |= std::ios_base::failbit;
+    }
+    if (str.empty())
+      state |= std::ios_base::failbit;
+    return state;
+  });
+  return is;
+}
+
+/** Extract a line from a stream.
+
+    Extracts characters into `str` until `delim` is found,
+    the input ends, or `str` is full. The delimiter is
+    extracted but not stored. The characters are scanned
+    and copied directly from the buffer of the stream.
+
+    Sets `failbit` if no characters are extracted, or if
+    `str` becomes full before the delimiter is found, in
+    which case the remaining characters are not extracted.
+    If the stream buffer throws, sets `badbit`, and rethrows
+    the exception if `badbit` is set in `is.exceptions()`.
+
+    @return `is`
+
+    @param is The stream to extract from.
+    @param str The string to store the line in.
+    @param delim The delimiter.
+*/
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+inline
+std::basic_istream<CharT, Traits>&
+getline(
+  std::basic_istream<CharT, Traits>& is,
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& str,
+  CharT delim)
+{
+  typename std::basic_istream<CharT, Traits>::sentry se(is, true);
+  if (!se)
+    return is;
+  str.clear();
+  detail::guarded_extract(is, [&]() -> std::ios_base::iostate
+  {
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    const bool found = detail::read_until(*is.rdbuf(), str, state,
+      [delim](const CharT* first, const CharT* last)
+      {
+        const CharT* const res =
+          Traits::find(first, last - first, delim);
+        return res ? res : last;
+      });
+    if (found)
+      is.rdbuf()->sbumpc();
+    else if (!(state & std::ios_base::eofbit))
+      state |= std::ios_base::failbit;
+    else if (str.empty())
+      state |= std::ios_base::failbit;
+    return state;
+  });
+  return is;
+}
+
+/** Extract a line from a stream.
+
+    Equivalent to `getline(is, str, is.widen('\n'))`.
+
+    @return `is`
+
+    @param is The stream to extract from.
+    @param str The string to store the line in.
+*/
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+inline
+std::basic_istream<CharT, Traits>&
+getline(
+  std::basic_istream<CharT, Traits>& is,
+  basic_static_string<N, CharT, Traits, OverflowPolicy>& str)
+{
+  return getline(is, str, is.widen('\n'));
+}
+
+/** A stream buffer which writes to a fixed-capacity string.
+
+    The characters written to the buffer are stored directly
+    in a @ref basic_static_string held by the buffer, so
+    formatting output does not allocate. Once the string is
+    full, further characters are either rejected, which sets
+    `badbit` on a stream using the buffer, or discarded if
+    the buffer truncates.
+
+    The put position can be queried and moved, as with
+    `std::basic_stringbuf` in output mode. Moving it back
+    overwrites the characters written, and the contents
+    end at the furthest position written.
+
+    The size of the held string is updated when @ref str
+    is called on a non-const buffer. Calling `str` on a
+    const buffer returns a copy, and @ref view does not
+    copy, so neither modifies the buffer.
+
+    @par Example
+
+    @code
+    static_stringbuf<128> buf;
+    std::ostream os(&buf);
+    os << "id=" << id << " price=" << price;
+    log(buf.str());
+    @endcode
+
+    @see basic_static_ostringstream
+*/
+template<std::size_t N, typename CharT,
+  typename Traits = std::char_traits<CharT>>
+class basic_static_stringbuf
+  : public std::basic_streambuf<CharT, Traits>
+{
+public:
+  using char_type = CharT;
+  using traits_type = Traits;
+  using int_type = typename Traits::int_type;
+  using pos_type = typename Traits::pos_type;
+  using off_type = typename Traits::off_type;
+
+  /// The type of string written to.
+  using string_type = basic_static_string<N, CharT, Traits>;
+
+  /** Constructor.
+
+      Construct a buffer holding an empty string.
+
+      @param truncate Whether characters which do not fit are
+      discarded rather than rejected.
+  */
+  explicit
+  basic_static_stringbuf(bool truncate = false) noexcept
+    : truncate_(truncate)
+  {
+    reset();
+  }
+
+  /** Constructor.
+
+      Construct a buffer holding a copy of `s`, after
+      which further characters are written.
+
+      @param s The initial contents.
+      @param truncate Whether characters which do not fit are
+      discarded rather than rejected.
+  */
+  explicit
+  basic_static_stringbuf(
+    const string_type& s,
+    bool truncate = false) noexcept
+    : str_(s)
+    , truncate_(truncate)
+  {
+    reset();
+  }
+
+  basic_static_stringbuf(const basic_static_stringbuf&) = delete;
+
+  basic_static_stringbuf&
+  operator=(const basic_static_stringbuf&) = delete;
+
+  /** Return the characters written.
+
+      Updates the size of the held string to the
+      characters written, and returns it.
+  */
+  const string_type&
+  str() noexcept
+  {
+    detail::string_access::set_size(str_, written());
+    return str_;
+  }
+
+  /// Return a copy of the characters written.
+  string_type
+  str() const noexcept
+  {
+    return detail::string_access::make<string_type>(
+      this->pbase(), this->pbase() + written());
+  }
+
+  /** Replace the contents of the buffer.
+
+      Replaces the characters written with a copy of `s`,
+      after which further characters are written.
+
+      @param s The new contents.
+  */
+  void
+  str(const string_type& s) noexcept
+  {
+    str_ = s;
+    truncated_ = false;
+    reset();
+  }
+
+  /// Remove the characters written.
+  void
+  clear() noexcept
+  {
+    str_.clear();
+    truncated_ = false;
+    reset();
+  }
+
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+  /// Return a view of the characters written.
+  basic_string_view<CharT, Traits>
+  view() const noexcept
+  {
+    return basic_string_view<CharT, Traits>(
+      this->pbase(), written());
+  }
+#endif
+
+  /// Return whether characters which do not fit are discarded.
+  bool
+  truncates() const noexcept
+  {
+    return truncate_;
+  }
+
+  /// Return whether characters have been discarded.
+  bool
+  truncated() const noexcept
+  {
+    return truncated_;
+  }
+
+protected:
+  /** Write a character when the string is full.
+
+      @return `Traits::not_eof(ch)` if the buffer truncates,
+      and `Traits::eof()` otherwise.
+  */
+  int_type
+  overflow(int_type ch = Traits::eof()) override
+  {
+    if (Traits::eq_int_type(ch, Traits::eof()))
+      return Traits::not_eof(ch);
+    if (!truncate_)
+      return Traits::eof();
+    truncated_ = true;
+    return ch;
+  }
+
+  /** Move the put position.
+
+      Moves the put position to `off` characters from the
+      beginning, the current put position, or the end of
+      the characters written, as given by `way`. The new
+      position must not be past the end of the characters
+      written.
+
+      @return The new position, or `pos_type(off_type(-1))`
+      if `which` includes `std::ios_base::in` or the new
+      position is out of range.
+  */
+  pos_type
+  seekoff(
+    off_type off,
+    std::ios_base::seekdir way,
+    std::ios_base::openmode which =
+      std::ios_base::in | std::ios_base::out) override
+  {
+    if ((which & std::ios_base::in) || !(which & std::ios_base::out))
+      return pos_type(off_type(-1));
+    const off_type size = static_cast<off_type>(written());
+    off_type pos = off;
+    if (way == std::ios_base::cur)
+      pos += static_cast<off_type>(this->pptr() - this->pbase());
+    else if (way == std::ios_base::end)
+      pos += size;
+    if (pos < 0 || pos > size)
+      return pos_type(off_type(-1));
+    // remember the furthest position written
+    detail::string_access::set_size(str_, static_cast<std::size_t>(size));
+    this->setp(this->pbase(), this->epptr());
+    this->pbump(static_cast<int>(pos));
+    return pos_type(pos);
+  }
+
+  /** Move the put position.
+
+      Equivalent to `seekoff(off_type(pos), std::ios_base::beg, which)`.
+  */
+  pos_type
+  seekpos(
+    pos_type pos,
+    std::ios_base::openmode which =
+      std::ios_base::in | std::ios_base::out) override
+  {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+
+private:
+  // The put area is the storage of the string
+  void
+  reset() noexcept
+  {
+    CharT* const first = str_.data();
+    this->setp(first, first + N);
+    this->pbump(static_cast<int>(str_.size()));
+  }
+
+  // The size of the string is only updated by str and
+  // seekoff, so the characters written end at the put
+  // position or the furthest position seeked from
+  std::size_t
+  written() const noexcept
+  {
+    return (std::max)(str_.size(),
+      static_cast<std::size_t>(this->pptr() - this->pbase()));
+  }
+
+  string_type str_;
+  bool truncate_;
+  bool truncated_ = false;
+};
+
+/** An output stream which writes to a fixed-capacity string.
+
+    The characters written to the stream are stored directly
+    in a @ref basic_static_string, so formatting output does
+    not allocate. Once the string is full, further output sets
+    `badbit`, or is discarded if the stream truncates.
+
+    @par Example
+
+    @code
+    static_ostringstream<128> os;
+    os << "id=" << id << " price=" << price;
+    log(os.str());
+    @endcode
+
+    @see basic_static_stringbuf
+*/
+template<std::size_t N, typename CharT,
+  typename Traits = std::char_traits<CharT>>
+class basic_static_ostringstream
+  : public std::basic_ostream<CharT, Traits>
+{
+public:
+  using char_type = CharT;
+  using traits_type = Traits;
+  using int_type = typename Traits::int_type;
+  using pos_type = typename Traits::pos_type;
+  using off_type = typename Traits::off_type;
+
+  /// The type of string written to.
+  using string_type = basic_static_string<N, CharT, Traits>;
+
+  /** Constructor.
+
+      Construct a stream holding an empty string.
+
+      @param truncate Whether output which does not fit is
+      discarded rather than setting `badbit`.
+  */
+  explicit
+  basic_static_ostringstream(bool truncate = false)
+    : std::basic_ostream<CharT, Traits>(nullptr)
+    , buf_(truncate)
+  {
+    this->init(&buf_);
+  }
+
+  /** Constructor.
+
+      Construct a stream holding a copy of `s`, after
+      which further output is written.
+
+      @param s The initial contents.
+      @param truncate Whether output which does not fit is
+      discarded rather than setting `badbit`.
+  */
+  explicit
+  basic_static_ostringstream(
+    const string_type& s,
+    bool truncate = false)
+    : std::basic_ostream<CharT, Traits>(nullptr)
+    , buf_(s, truncate)
+  {
+    this->init(&buf_);
+  }
+
+  /// Return the stream buffer.
+  basic_static_stringbuf<N, CharT, Traits>*
+  rdbuf() const noexcept
+  {
+    return const_cast<
+      basic_static_stringbuf<N, CharT, Traits>*>(&buf_);
+  }
+
+  /** Return the characters written.
+
+      Updates the size of the held string to the
+      characters written, and returns it.
+  */
+  const string_type&
+  str() noexcept
+  {
+    return buf_.str();
+  }
+
+  /// Return a copy of the characters written.
+  string_type
+  str() const noexcept
+  {
+    return buf_.str();
+  }
+
+  /** Replace the contents of the stream.
+
+      Replaces the characters written with a copy of `s`,
+      after which further output is written. The state of
+      the stream is not changed.
+
+      @param s The new contents.
+  */
+  void
+  str(const string_type& s) noexcept
+  {
+    buf_.str(s);
+  }
+
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+  /// Return a view of the characters written.
+  basic_string_view<CharT, Traits>
+  view() const noexcept
+  {
+    return buf_.view();
+  }
+#endif
+
+private:
+  basic_static_stringbuf<N, CharT, Traits> buf_;
+};
+
+/// A stream buffer which writes to a `static_string`.
+template<std::size_t N>
+using static_stringbuf = basic_static_stringbuf<N, char>;
+
+/// An output stream which writes to a `static_string`.
+template<std::size_t N>
+using static_ostringstream = basic_static_ostringstream<N, char>;
+
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+/// A stream buffer which writes to a `static_wstring`.
+template<std::size_t N>
+using static_wstringbuf = basic_static_stringbuf<N, wchar_t>;
+
+/// An output stream which writes to a `static_wstring`.
+template<std::size_t N>
+using static_wostringstream = basic_static_ostringstream<N, wchar_t>;
+#endif
+
 //------------------------------------------------------------------------------
 //
 // Numeric conversions
@@ -6147,11 +12239,20 @@ operator<<(
 
 // Unsigned overloads have a + 1, for the missing digit.
 
-// Floating point overloads have a + 4, for the sign
+// Overloads with a base use the number of binary digits,
+// since base 2 is the longest. The signed ones have a + 2,
+// for the missing digit and the sign.
+
+// The long double overload has a + 4, for the sign
 // of the integral part, sign of the exponent, the 'e',
 // and the decimal.
 
+// The float and double overloads have a + 7, for the
+// sign, the decimal, the 'e', the sign of the exponent,
+// and up to three exponent digits.
+
 /// Converts `value` to a `static_string`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_string<std::numeric_limits<int>::digits10 + 2>
 inline
 to_static_string(int value) noexcept
@@ -6161,6 +12262,7 @@ to_static_string(int value) noexcept
 }
 
 /// Converts `value` to a `static_string`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_string<std::numeric_limits<long>::digits10 + 2>
 inline
 to_static_string(long value) noexcept
@@ -6170,6 +12272,7 @@ to_static_string(long value) noexcept
 }
 
 /// Converts `value` to a `static_string`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_string<std::numeric_limits<long long>::digits10 + 2>
 inline
 to_static_string(long long value) noexcept
@@ -6179,6 +12282,7 @@ to_static_string(long long value) noexcept
 }
 
 /// Converts `value` to a `static_string`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_string<std::numeric_limits<unsigned int>::digits10 + 1>
 inline
 to_static_string(unsigned int value) noexcept
@@ -6188,6 +12292,7 @@ to_static_string(unsigned int value) noexcept
 }
 
 /// Converts `value` to a `static_string`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_string<std::numeric_limits<unsigned long>::digits10 + 1>
 inline
 to_static_string(unsigned long value) noexcept
@@ -6197,6 +12302,7 @@ to_static_string(unsigned long value) noexcept
 }
 
 /// Converts `value` to a `static_string`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_string<std::numeric_limits<unsigned long long>::digits10 + 1>
 inline
 to_static_string(unsigned long long value) noexcept
@@ -6205,24 +12311,123 @@ to_static_string(unsigned long long value) noexcept
     std::numeric_limits<unsigned long long>::digits10 + 1>(value);
 }
 
-/// Converts `value` to a `static_string`
-static_string<std::numeric_limits<float>::max_digits10 + 4>
+/** Converts `value` to a `static_string` in the given base
+
+    Digits above 9 are lowercase letters. The result is padded
+    on the left with `fill` to at least `width` characters, with
+    zeros placed after the sign. `width` is limited to the capacity.
+
+    @par Constraints
+
+    `std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value`
+
+    @param value The value to convert.
+    @param base The base, in the range `[2, 36]`.
+    @param width The minimum size of the result.
+    @param fill The character to pad with.
+
+    @throw std::invalid_argument if `base` is not in the range `[2, 36]`
+*/
+template<typename Integer
+#ifndef BOOST_STATIC_STRING_DOCS
+  , typename = typename std::enable_if<
+      std::is_integral<Integer>::value &&
+      !std::is_same<Integer, bool>::value>::type
+#endif
+>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+static_string<std::numeric_limits<Integer>::digits +
+  2 * std::is_signed<Integer>::value>
+to_static_string_base(
+  Integer value,
+  int base,
+  std::size_t width = 0,
+  char fill = '0')
+{
+  return detail::to_static_string_int_impl<
+    std::numeric_limits<Integer>::digits +
+      2 * std::is_signed<Integer>::value>(value, base, width, fill);
+}
+
+/** Converts `value` to a `static_string`
+
+    The result is the shortest string that converts back to
+    `value`, in fixed or scientific notation, whichever is
+    shorter, like `std::to_chars` without a precision. It does
+    not depend on the locale. The capacity is enough for the
+    longest such string, so no value loses digits.
+*/
+static_string<std::numeric_limits<float>::max_digits10 + 7>
 inline
 to_static_string(float value) noexcept
 {
-  return detail::to_static_string_float_impl<
-    std::numeric_limits<float>::max_digits10 + 4>(value);
+  return detail::float_to_string<
+    std::numeric_limits<float>::max_digits10 + 7, char>(value);
 }
 
-/// Converts `value` to a `static_string`
-static_string<std::numeric_limits<double>::max_digits10 + 4>
+/** Converts `value` to a `static_string`
+
+    The result is the shortest string that converts back to
+    `value`, in fixed or scientific notation, whichever is
+    shorter, like `std::to_chars` without a precision. It does
+    not depend on the locale. The capacity is enough for the
+    longest such string, so no value loses digits.
+*/
+static_string<std::numeric_limits<double>::max_digits10 + 7>
 inline
 to_static_string(double value) noexcept
 {
-  return detail::to_static_string_float_impl<
-    std::numeric_limits<double>::max_digits10 + 4>(value);
+  return detail::float_to_string<
+    std::numeric_limits<double>::max_digits10 + 7, char>(value);
+}
+
+/** Converts `value` to a `static_string` with the given precision
+
+    The result is formatted like `std::printf` with `"%.*g"`, with
+    the trailing zeros of the fraction removed, and does not depend
+    on the locale. The precision is the number of significant
+    digits, and is clamped to `[1, max_digits10]`.
+*/
+static_string<std::numeric_limits<float>::max_digits10 + 7>
+inline
+to_static_string(
+  float value,
+  int precision) noexcept
+{
+  return detail::float_to_string<
+    std::numeric_limits<float>::max_digits10 + 7, char>(value, precision);
 }
 
+/** Converts `value` to a `static_string` with the given precision
+
+    The result is formatted like `std::printf` with `"%.*g"`, with
+    the trailing zeros of the fraction removed, and does not depend
+    on the locale. The precision is the number of significant
+    digits, and is clamped to `[1, max_digits10]`.
+*/
+static_string<std::numeric_limits<double>::max_digits10 + 7>
+inline
+to_static_string(
+  double value,
+  int precision) noexcept
+{
+  return detail::float_to_string<
+    std::numeric_limits<double>::max_digits10 + 7, char>(value, precision);
+}
+
+#ifndef BOOST_STATIC_STRING_DOCS
+// An integer would otherwise convert to double and
+// ignore the second argument, which is likely meant as
+// a base. Integers in a base use to_static_string_base.
+template<typename Integer, typename = typename std::enable_if<
+  std::is_integral<Integer>::value>::type>
+void
+to_static_string(
+  Integer value,
+  int precision) = delete;
+#endif
+
 /// Converts `value` to a `static_string`
 static_string<std::numeric_limits<long double>::max_digits10 + 4>
 inline
@@ -6234,6 +12439,7 @@ to_static_string(long double value) noexcept
 
 #ifdef BOOST_STATIC_STRING_HAS_WCHAR
 /// Converts `value` to a `static_wstring`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_wstring<std::numeric_limits<int>::digits10 + 2>
 inline
 to_static_wstring(int value) noexcept
@@ -6243,6 +12449,7 @@ to_static_wstring(int value) noexcept
 }
 
 /// Converts `value` to a `static_wstring`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_wstring<std::numeric_limits<long>::digits10 + 2>
 inline
 to_static_wstring(long value) noexcept
@@ -6252,6 +12459,7 @@ to_static_wstring(long value) noexcept
 }
 
 /// Converts `value` to a `static_wstring`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_wstring<std::numeric_limits<long long>::digits10 + 2>
 inline
 to_static_wstring(long long value) noexcept
@@ -6261,6 +12469,7 @@ to_static_wstring(long long value) noexcept
 }
 
 /// Converts `value` to a `static_wstring`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_wstring<std::numeric_limits<unsigned int>::digits10 + 1>
 inline
 to_static_wstring(unsigned int value) noexcept
@@ -6270,6 +12479,7 @@ to_static_wstring(unsigned int value) noexcept
 }
 
 /// Converts `value` to a `static_wstring`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_wstring<std::numeric_limits<unsigned long>::digits10 + 1>
 inline
 to_static_wstring(unsigned long value) noexcept
@@ -6279,6 +12489,7 @@ to_static_wstring(unsigned long value) noexcept
 }
 
 /// Converts `value` to a `static_wstring`
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
 static_wstring<std::numeric_limits<unsigned long long>::digits10 + 1>
 inline
 to_static_wstring(unsigned long long value) noexcept
@@ -6287,24 +12498,123 @@ to_static_wstring(unsigned long long value) noexcept
     std::numeric_limits<unsigned long long>::digits10 + 1>(value);
 }
 
-/// Converts `value` to a `static_wstring`
-static_wstring<std::numeric_limits<float>::max_digits10 + 4>
+/** Converts `value` to a `static_wstring` in the given base
+
+    Digits above 9 are lowercase letters. The result is padded
+    on the left with `fill` to at least `width` characters, with
+    zeros placed after the sign. `width` is limited to the capacity.
+
+    @par Constraints
+
+    `std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value`
+
+    @param value The value to convert.
+    @param base The base, in the range `[2, 36]`.
+    @param width The minimum size of the result.
+    @param fill The character to pad with.
+
+    @throw std::invalid_argument if `base` is not in the range `[2, 36]`
+*/
+template<typename Integer
+#ifndef BOOST_STATIC_STRING_DOCS
+  , typename = typename std::enable_if<
+      std::is_integral<Integer>::value &&
+      !std::is_same<Integer, bool>::value>::type
+#endif
+>
+BOOST_STATIC_STRING_CPP20_CONSTEXPR
+inline
+static_wstring<std::numeric_limits<Integer>::digits +
+  2 * std::is_signed<Integer>::value>
+to_static_wstring_base(
+  Integer value,
+  int base,
+  std::size_t width = 0,
+  wchar_t fill = L'0')
+{
+  return detail::to_static_string_int_impl<
+    std::numeric_limits<Integer>::digits +
+      2 * std::is_signed<Integer>::value>(value, base, width, fill);
+}
+
+/** Converts `value` to a `static_wstring`
+
+    The result is the shortest string that converts back to
+    `value`, in fixed or scientific notation, whichever is
+    shorter, like `std::to_chars` without a precision. It does
+    not depend on the locale. The capacity is enough for the
+    longest such string, so no value loses digits.
+*/
+static_wstring<std::numeric_limits<float>::max_digits10 + 7>
 inline
 to_static_wstring(float value) noexcept
 {
-  return detail::to_static_wstring_float_impl<
-    std::numeric_limits<float>::max_digits10 + 4>(value);
+  return detail::float_to_string<
+    std::numeric_limits<float>::max_digits10 + 7, wchar_t>(value);
 }
 
-/// Converts `value` to a `static_wstring`
-static_wstring<std::numeric_limits<double>::max_digits10 + 4>
+/** Converts `value` to a `static_wstring`
+
+    The result is the shortest string that converts back to
+    `value`, in fixed or scientific notation, whichever is
+    shorter, like `std::to_chars` without a precision. It does
+    not depend on the locale. The capacity is enough for the
+    longest such string, so no value loses digits.
+*/
+static_wstring<std::numeric_limits<double>::max_digits10 + 7>
 inline
 to_static_wstring(double value) noexcept
 {
-  return detail::to_static_wstring_float_impl<
-    std::numeric_limits<double>::max_digits10 + 4>(value);
+  return detail::float_to_string<
+    std::numeric_limits<double>::max_digits10 + 7, wchar_t>(value);
+}
+
+/** Converts `value` to a `static_wstring` with the given precision
+
+    The result is formatted like `std::printf` with `"%.*g"`, with
+    the trailing zeros of the fraction removed, and does not depend
+    on the locale. The precision is the number of significant
+    digits, and is clamped to `[1, max_digits10]`.
+*/
+static_wstring<std::numeric_limits<float>::max_digits10 + 7>
+inline
+to_static_wstring(
+  float value,
+  int precision) noexcept
+{
+  return detail::float_to_string<
+    std::numeric_limits<float>::max_digits10 + 7, wchar_t>(value, precision);
+}
+
+/** Converts `value` to a `static_wstring` with the given precision
+
+    The result is formatted like `std::printf` with `"%.*g"`, with
+    the trailing zeros of the fraction removed, and does not depend
+    on the locale. The precision is the number of significant
+    digits, and is clamped to `[1, max_digits10]`.
+*/
+static_wstring<std::numeric_limits<double>::max_digits10 + 7>
+inline
+to_static_wstring(
+  double value,
+  int precision) noexcept
+{
+  return detail::float_to_string<
+    std::numeric_limits<double>::max_digits10 + 7, wchar_t>(value, precision);
 }
 
+#ifndef BOOST_STATIC_STRING_DOCS
+// An integer would otherwise convert to double and
+// ignore the second argument, which is likely meant as
+// a base. Integers in a base use to_static_wstring_base.
+template<typename Integer, typename = typename std::enable_if<
+  std::is_integral<Integer>::value>::type>
+void
+to_static_wstring(
+  Integer value,
+  int precision) = delete;
+#endif
+
 /// Converts `value` to a `static_wstring`
 static_wstring<std::numeric_limits<long double>::max_digits10 + 4>
 inline
@@ -6315,6 +12625,92 @@ to_static_wstring(long double value) noexcept
 }
 #endif
 
+/** The result of converting a string to a number.
+
+    @see to_integer, to_floating
+*/
+template<typename T>
+struct conversion_result
+{
+  /// The converted value, or `T()` if the conversion failed.
+  T value;
+
+  /// The number of characters that make up the number.
+  std::size_t size;
+
+  /** The error, if any.
+
+      This is `std::errc()` on success,
+      `std::errc::invalid_argument` if the string does not
+      start with a number, and `std::errc::result_out_of_range`
+      if the number is not representable by `T`.
+  */
+  std::errc ec;
+};
+
+/** Converts the leading characters of a string to an integer.
+
+    The string is parsed like `std::from_chars`: an optional
+    minus sign, only for signed types, followed by one or more
+    digits in `base`. Letters are used for the digits above 9.
+    Leading whitespace, a plus sign, and a base prefix are not
+    accepted. The conversion does not depend on the locale
+    and does not throw.
+
+    @par Complexity
+
+    Linear in `s.size()`.
+
+    @param s The string to convert.
+    @param base The base, in the range `[2, 36]`.
+*/
+template<typename T, std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+inline
+conversion_result<T>
+to_integer(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& s,
+  int base = 10) noexcept
+{
+  static_assert(std::is_integral<T>::value &&
+    !std::is_same<T, bool>::value, "T must be an integer type");
+  conversion_result<T> r{T(), 0, std::errc()};
+  r.ec = detail::parse_integer(s.data(), s.size(), base, r.value, r.size);
+  return r;
+}
+
+/** Converts the leading characters of a string to a floating point number.
+
+    The string is parsed like `std::from_chars` with
+    `std::chars_format::general`: an optional minus sign followed
+    by `inf`, `infinity`, `nan`, `nan(chars)`, or digits with an
+    optional decimal point and an optional exponent. The decimal
+    point is always `'.'`, and the conversion does not throw.
+    The result is rounded to nearest. Short numbers are converted
+    directly, the others through `std::strtod`, without the
+    decimal point, so that the locale has no effect.
+
+    @par Complexity
+
+    Linear in `s.size()`.
+
+    @param s The string to convert.
+*/
+template<typename T, std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+inline
+conversion_result<T>
+to_floating(
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& s) noexcept
+{
+  static_assert(std::is_floating_point<T>::value,
+    "T must be a floating point type");
+  conversion_result<T> r{T(), 0, std::errc()};
+  r.ec = detail::parse_float(s.data(), s.size(), r.value, r.size);
+  return r;
+}
+
 //------------------------------------------------------------------------------
 //
 // Deduction Guides
@@ -6333,18 +12729,251 @@ basic_static_string(const CharT(&)[N]) ->
 //
 //------------------------------------------------------------------------------
 
+/** A fast hash function object for strings.
+
+    Hashes the characters of a string in bulk, consuming
+    several bytes per step. The algorithm is wyhash when
+    `std::size_t` is 64 bits and wyhash32 when it is 32 bits.
+    The results are not the same as those of `std::hash`
+    or `boost::hash` for other string types, and may differ
+    between platforms.
+
+    @par Example
+
+    @code
+    std::unordered_set<static_string<32>, fast_hash> set;
+    @endcode
+*/
+struct fast_hash
+{
+  /// Return the hash of a string.
+  template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+  std::size_t
+  operator()(
+    const basic_static_string<N, CharT, Traits, OverflowPolicy>& str) const noexcept
+  {
+    return detail::hash_bytes(
+      reinterpret_cast<const unsigned char*>(str.data()),
+      str.size() * sizeof(CharT));
+  }
+};
+
+/** A transparent hash function object for strings.
+
+    Hashes any `basic_static_string<N, CharT, Traits>`,
+    string view or other type with `data` and `size` member
+    functions, as well as null-terminated strings. Equal
+    strings produce the same value regardless of their type,
+    which is also the value produced by `std::hash` for
+    `basic_static_string`. This allows containers keyed
+    by static strings to be searched with other string
+    types without constructing a temporary.
+
+    @par Example
+
+    @code
+    std::unordered_map<static_string<64>, int,
+      static_string_hash, static_string_equal> map;
+    auto it = map.find(string_view("key"));
+    @endcode
+
+    @see basic_static_string_equal, basic_static_string_less
+*/
+template<typename CharT,
+  typename Traits = std::char_traits<CharT>>
+struct basic_static_string_hash
+{
+  /// Enables heterogeneous lookup.
+  using is_transparent = void;
+
+  /// Return the hash of a string.
+  template<typename T
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = typename std::enable_if<
+        detail::is_char_range<T, CharT>::value>::type
+#endif
+  >
+  std::size_t
+  operator()(const T& t) const noexcept
+  {
+    const auto r = detail::to_char_range<Traits, CharT>(t);
+    return detail::hash_chars<CharT, Traits>(r.data, r.size);
+  }
+};
+
+/** A transparent equality function object for strings.
+
+    Compares any combination of `basic_static_string<N, CharT, Traits>`,
+    string views or other types with `data` and `size` member
+    functions, and null-terminated strings.
+
+    @see basic_static_string_hash
+*/
+template<typename CharT,
+  typename Traits = std::char_traits<CharT>>
+struct basic_static_string_equal
+{
+  /// Enables heterogeneous lookup.
+  using is_transparent = void;
+
+  /// Return whether two strings are equal.
+  template<typename T, typename U
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = typename std::enable_if<
+        detail::is_char_range<T, CharT>::value &&
+        detail::is_char_range<U, CharT>::value>::type
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  operator()(
+    const T& lhs,
+    const U& rhs) const noexcept
+  {
+    const auto l = detail::to_char_range<Traits, CharT>(lhs);
+    const auto r = detail::to_char_range<Traits, CharT>(rhs);
+    return detail::equal<Traits>(l.data, l.size, r.data, r.size);
+  }
+};
+
+/** A transparent ordering function object for strings.
+
+    Lexicographically compares any combination of
+    `basic_static_string<N, CharT, Traits>`, string views
+    or other types with `data` and `size` member functions,
+    and null-terminated strings.
+
+    @see basic_static_string_hash
+*/
+template<typename CharT,
+  typename Traits = std::char_traits<CharT>>
+struct basic_static_string_less
+{
+  /// Enables heterogeneous lookup.
+  using is_transparent = void;
+
+  /// Return whether `lhs` is ordered before `rhs`.
+  template<typename T, typename U
+#ifndef BOOST_STATIC_STRING_DOCS
+    , typename = typename std::enable_if<
+        detail::is_char_range<T, CharT>::value &&
+        detail::is_char_range<U, CharT>::value>::type
+#endif
+  >
+  BOOST_STATIC_STRING_CPP14_CONSTEXPR
+  bool
+  operator()(
+    const T& lhs,
+    const U& rhs) const noexcept
+  {
+    const auto l = detail::to_char_range<Traits, CharT>(lhs);
+    const auto r = detail::to_char_range<Traits, CharT>(rhs);
+    return detail::lexicographical_compare<CharT, Traits>(
+      l.data, l.size, r.data, r.size) < 0;
+  }
+};
+
+/// Transparent hash function object for `static_string`.
+using static_string_hash = basic_static_string_hash<char>;
+
+/// Transparent equality function object for `static_string`.
+using static_string_equal = basic_static_string_equal<char>;
+
+/// Transparent ordering function object for `static_string`.
+using static_string_less = basic_static_string_less<char>;
+
 #ifndef BOOST_STATIC_STRING_STANDALONE
 /// hash_value overload for Boost.Container_Hash
 template <std::size_t N,
   typename CharT,
-  typename Traits>
+  typename Traits,
+  typename OverflowPolicy>
 std::size_t
 hash_value(
-  const basic_static_string<N, CharT, Traits>& str)
+  const basic_static_string<N, CharT, Traits, OverflowPolicy>& str)
 {
   return boost::hash_range(str.begin(), str.end());
 }
 #endif
+
+#ifdef BOOST_STATIC_STRING_HAS_FORMAT
+//------------------------------------------------------------------------------
+//
+// Formatting
+//
+//------------------------------------------------------------------------------
+
+/** Format arguments into a string.
+
+    Formats `args` according to the format string `fmt`,
+    as `std::format` does, writing the characters directly
+    into the returned string without allocating.
+
+    @par Example
+
+    @code
+    static_string<32> s = static_format<32>("{}:{}", host, port);
+    @endcode
+
+    @tparam N The capacity of the returned string.
+
+    @return The formatted string.
+
+    @param fmt The format string.
+
+    @param args The arguments to format.
+
+    @throw std::length_error if the result does not fit
+    @throw std::format_error if `fmt` is not valid for `args`
+*/
+template<std::size_t N, typename... Args>
+static_string<N>
+static_format(
+  detail::format_string<Args...> fmt,
+  Args&&... args)
+{
+  static_string<N> result;
+  std::vformat_to(
+    detail::format_iterator<static_string<N>>(result),
+    detail::format_view(fmt),
+    std::make_format_args(args...)).commit();
+  return result;
+}
+
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+/** Format arguments into a string.
+
+    Formats `args` according to the format string `fmt`,
+    as `std::format` does, writing the characters directly
+    into the returned string without allocating.
+
+    @tparam N The capacity of the returned string.
+
+    @return The formatted string.
+
+    @param fmt The format string.
+
+    @param args The arguments to format.
+
+    @throw std::length_error if the result does not fit
+    @throw std::format_error if `fmt` is not valid for `args`
+*/
+template<std::size_t N, typename... Args>
+static_wstring<N>
+static_format(
+  detail::wformat_string<Args...> fmt,
+  Args&&... args)
+{
+  static_wstring<N> result;
+  std::vformat_to(
+    detail::format_iterator<static_wstring<N>>(result),
+    detail::format_view(fmt),
+    std::make_wformat_args(args...)).commit();
+  return result;
+}
+#endif
+#endif
 } // static_strings
 
 //------------------------------------------------------------------------------
@@ -6364,52 +12993,49 @@ using static_strings::static_u32string;
 /// std::hash partial specialization for basic_static_string
 namespace std {
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 struct hash<
 #ifdef BOOST_STATIC_STRING_DOCS
   basic_static_string
 #else
-  boost::static_strings::basic_static_string<N, CharT, Traits>
+  boost::static_strings::basic_static_string<N, CharT, Traits, OverflowPolicy>
 #endif
   >
 {
   std::size_t
   operator()(
-    const boost::static_strings::basic_static_string<N, CharT, Traits>& str) const noexcept
+    const boost::static_strings::basic_static_string<N, CharT, Traits, OverflowPolicy>& str) const noexcept
   {
-#if !defined(BOOST_STATIC_STRING_STANDALONE)
-    return boost::hash_range(str.begin(), str.end());
-#elif defined(BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW)
-    using view_type = typename
-      boost::static_strings::basic_string_view<CharT, Traits>;
-    return std::hash<view_type>()(view_type(str.data(), str.size()));
+    return boost::static_strings::detail::hash_chars<CharT, Traits>(
+      str.data(), str.size());
+  }
+};
+
+#ifdef BOOST_STATIC_STRING_HAS_FORMAT
+/// std::formatter partial specialization for basic_static_string
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+struct formatter<
+#ifdef BOOST_STATIC_STRING_DOCS
+  basic_static_string
 #else
-    std::size_t seed = 0;
-    for (CharT const& c : str)
-    {
-#if BOOST_STATIC_STRING_ARCH == 64
-      seed += 0x9e3779b9 + std::hash<CharT>()( c );
-      std::size_t const m = (std::size_t(0xe9846af) << 32) + 0x9b1a615d;
-      seed ^= seed >> 32;
-      seed *= m;
-      seed ^= seed >> 32;
-      seed *= m;
-      seed ^= seed >> 28;
-#elif BOOST_STATIC_STRING_ARCH == 32
-      seed += 0x9e3779b9 + std::hash<CharT>()( c );
-      std::size_t const m1 = 0x21f0aaad;
-      std::size_t const m2 = 0x735a2d97;
-      seed ^= seed >> 16;
-      seed *= m1;
-      seed ^= seed >> 15;
-      seed *= m2;
-      seed ^= seed >> 15;
-#endif
-    }
-    return seed;
+  boost::static_strings::basic_static_string<N, CharT, Traits, OverflowPolicy>
 #endif
+  , CharT>
+  : formatter<basic_string_view<CharT>, CharT>
+{
+  template<typename FormatContext>
+  typename FormatContext::iterator
+  format(
+    const boost::static_strings::basic_static_string<N, CharT, Traits, OverflowPolicy>& str,
+    FormatContext& ctx) const
+  {
+    return formatter<basic_string_view<CharT>, CharT>::format(
+      basic_string_view<CharT>(str.data(), str.size()), ctx);
   }
 };
+#endif
 } // std
 
 //--------------------------------------------------------------------------
@@ -6422,45 +13048,44 @@ struct hash<
 namespace boost {
 namespace static_strings {
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 assign(
   size_type count,
   value_type ch) ->
     basic_static_string&
 {
-  if (count > max_size())
-    detail::throw_exception<std::length_error>(
-      "count > max_size()");
+  count = checked_count(count, max_size(), "count > max_size()");
   this->set_size(count);
   traits_type::assign(data(), size(), ch);
   return term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 assign(
   const_pointer s,
   size_type count) ->
     basic_static_string&
 {
-  if (count > max_size())
-    detail::throw_exception<std::length_error>(
-      "count > max_size()");
+  count = checked_count(count, max_size(), "count > max_size()");
   this->set_size(count);
   traits_type::move(data(), s, size());
   return term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<typename InputIterator>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 assign(
   InputIterator first,
   InputIterator last) ->
@@ -6475,7 +13100,8 @@ assign(
     {
       this->set_size(i);
       term();
-      detail::throw_exception<std::length_error>("n > max_size()");
+      report_overflow("n > max_size()");
+      return *this;
     }
     traits_type::assign(*ptr, *first);
   }
@@ -6483,10 +13109,11 @@ assign(
   return term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 insert(
   const_iterator pos,
   size_type count,
@@ -6495,9 +13122,8 @@ insert(
 {
   const auto curr_size = size();
   const auto curr_data = data();
-  if (count > max_size() - curr_size)
-    detail::throw_exception<std::length_error>(
-      "count > max_size() - curr_size");
+  count = checked_count(count, max_size() - curr_size,
+    "count > max_size() - curr_size");
   const auto index = pos - curr_data;
   traits_type::move(&curr_data[index + count], &curr_data[index], curr_size - index + 1);
   traits_type::assign(&curr_data[index], count, ch);
@@ -6505,11 +13131,12 @@ insert(
   return &curr_data[index];
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<typename ForwardIterator>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 insert(
   const_iterator pos,
   ForwardIterator first,
@@ -6518,20 +13145,23 @@ insert(
       detail::is_forward_iterator<
         ForwardIterator>::value, iterator>::type
 {
-  // input
-  const std::size_t count = detail::distance(first, last);
-  const auto first_addr = &*first;
-  const auto last_addr = first_addr + count;
-
   // output
   const auto curr_size = size();
   const auto curr_data = data();
   const std::size_t index = pos - curr_data;
   auto dest = &curr_data[index];
 
-  if (count > max_size() - curr_size)
-    detail::throw_exception<std::length_error>(
-      "count > max_size() - curr_size");
+  // input
+  const std::size_t n = detail::distance(first, last);
+  const std::size_t count = checked_count(n, max_size() - curr_size,
+    "count > max_size() - curr_size");
+  if (count != n)
+  {
+    last = first;
+    std::advance(last, count);
+  }
+  const auto first_addr = &*first;
+  const auto last_addr = first_addr + count;
 
   traits_type::move(dest + count, dest, curr_size - index + 1);
   const bool inside = detail::ptr_in_range(curr_data, curr_data + curr_size, first_addr);
@@ -6558,11 +13188,12 @@ insert(
   return curr_data + index;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<typename InputIterator>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 insert(
   const_iterator pos,
   InputIterator first,
@@ -6582,10 +13213,11 @@ insert(
   return curr_data + index;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 erase(
   const_iterator first,
   const_iterator last) ->
@@ -6598,67 +13230,67 @@ erase(
   return curr_data + index;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 void
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 push_back(
   value_type ch)
 {
   const auto curr_size = size();
-  if (curr_size >= max_size())
-    detail::throw_exception<std::length_error>(
-      "curr_size >= max_size()");
+  if (!checked_count(1, max_size() - curr_size,
+      "curr_size >= max_size()"))
+    return;
   traits_type::assign(data()[curr_size], ch);
   this->set_size(curr_size + 1);
   term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 append(
   size_type count,
   value_type ch) ->
     basic_static_string&
 {
   const auto curr_size = size();
-  if (count > max_size() - curr_size)
-    detail::throw_exception<std::length_error>(
-      "count > max_size() - size()");
+  count = checked_count(count, max_size() - curr_size,
+    "count > max_size() - size()");
   traits_type::assign(end(), count, ch);
   this->set_size(curr_size + count);
   return term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 append(
   const_pointer s,
   size_type count) ->
     basic_static_string&
 {
   const auto curr_size = size();
-  if (count > max_size() - curr_size)
-    detail::throw_exception<std::length_error>(
-      "count > max_size() - size()");
+  count = checked_count(count, max_size() - curr_size,
+    "count > max_size() - size()");
   traits_type::copy(end(), s, count);
   this->set_size(curr_size + count);
   return term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 void
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 resize(size_type n, value_type c)
 {
-  if (n > max_size())
-    detail::throw_exception<std::length_error>(
-      "n > max_size()");
+  n = checked_count(n, max_size(), "n > max_size()");
   const auto curr_size = size();
   if(n > curr_size)
     traits_type::assign(data() + curr_size, n - curr_size, c);
@@ -6666,58 +13298,91 @@ resize(size_type n, value_type c)
   term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 void
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 swap(basic_static_string& s) noexcept
 {
-  const auto curr_size = size();
-  basic_static_string tmp(s);
-  s.set_size(curr_size);
-  traits_type::copy(&s.data()[0], data(), curr_size + 1);
-  this->set_size(tmp.size());
-  traits_type::copy(data(), tmp.data(), size() + 1);
+  if (&s == this)
+    return;
+  swap_unchecked(s);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<std::size_t M>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 void
-basic_static_string<N, CharT, Traits>::
-swap(basic_static_string<M, CharT, Traits>& s)
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
+swap(basic_static_string<M, CharT, Traits, OverflowPolicy>& s)
 {
-  const auto curr_size = size();
-  if (curr_size > s.max_size())
-    detail::throw_exception<std::length_error>(
-      "curr_size > s.max_size()");
+  // A policy which returns keeps the characters that
+  // fit, so each side is first cut down to the capacity
+  // of the other. The characters removed would have
+  // been discarded by the exchange anyway.
+  if (size() > s.max_size())
+  {
+    s.report_overflow("size() > s.max_size()");
+    this->set_size(s.max_size());
+  }
   if (s.size() > max_size())
-    detail::throw_exception<std::length_error>(
-      "s.size() > max_size()");
-  basic_static_string tmp(s);
+  {
+    report_overflow("s.size() > max_size()");
+    s.set_size(max_size());
+  }
+  swap_unchecked(s);
+}
+
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
+template<std::size_t M>
+BOOST_STATIC_STRING_CPP14_CONSTEXPR
+void
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
+swap_unchecked(basic_static_string<M, CharT, Traits, OverflowPolicy>& s) noexcept
+{
+  const auto curr_size = size();
+  const auto other_size = s.size();
+  const auto curr_data = data();
+  const auto other_data = s.data();
+  // Exchange the common prefix in place, then copy the
+  // tail of the longer string. Nothing past either
+  // null terminator is touched.
+  if (curr_size < other_size)
+  {
+    detail::swap_ranges<Traits>(curr_data, other_data, curr_size);
+    traits_type::copy(&curr_data[curr_size], &other_data[curr_size], other_size - curr_size);
+  }
+  else
+  {
+    detail::swap_ranges<Traits>(curr_data, other_data, other_size);
+    traits_type::copy(&other_data[other_size], &curr_data[other_size], curr_size - other_size);
+  }
+  this->set_size(other_size);
   s.set_size(curr_size);
-  traits_type::copy(&s.data()[0], data(), curr_size + 1);
-  this->set_size(tmp.size());
-  traits_type::copy(data(), &tmp.data()[0], size() + 1);
+  term();
+  s.term();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 replace(
   const_iterator i1,
   const_iterator i2,
   size_type n,
   value_type c) ->
-    basic_static_string<N, CharT, Traits>&
+    basic_static_string<N, CharT, Traits, OverflowPolicy>&
 {
   const auto curr_size = size();
   const auto curr_data = data();
   const std::size_t n1 = i2 - i1;
-  if (n > max_size() || curr_size - n1 >= max_size() - n)
-    detail::throw_exception<std::length_error>(
-      "replaced string exceeds max_size()");
+  n = checked_count(n, max_size() - (curr_size - n1),
+    "replaced string exceeds max_size()");
   const auto pos = i1 - curr_data;
   traits_type::move(&curr_data[pos + n], i2, (end() - i2) + 1);
   traits_type::assign(&curr_data[pos], n, c);
@@ -6725,11 +13390,12 @@ replace(
   return *this;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<typename ForwardIterator>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 replace(
   const_iterator i1,
   const_iterator i2,
@@ -6737,17 +13403,22 @@ replace(
   ForwardIterator j2) ->
     typename std::enable_if<
       detail::is_forward_iterator<ForwardIterator>::value,
-        basic_static_string<N, CharT, Traits>&>::type
+        basic_static_string<N, CharT, Traits, OverflowPolicy>&>::type
 {
   const auto curr_size = size();
   const auto curr_data = data();
   const auto first_addr = &*j1;
   const std::size_t n1 = i2 - i1;
-  const std::size_t n2 = detail::distance(j1, j2);
   const std::size_t pos = i1 - curr_data;
-  if (n2 > max_size() || curr_size - (std::min)(n1, curr_size - pos) >= max_size() - n2)
-    detail::throw_exception<std::length_error>(
-      "replaced string exceeds max_size()");
+  const std::size_t n = detail::distance(j1, j2);
+  const std::size_t n2 = checked_count(n,
+    max_size() - (curr_size - (std::min)(n1, curr_size - pos)),
+    "replaced string exceeds max_size()");
+  if (n2 != n)
+  {
+    j2 = j1;
+    std::advance(j2, n2);
+  }
   const bool inside = detail::ptr_in_range(curr_data, curr_data + curr_size, first_addr);
   if (inside && first_addr == i1 && n1 == n2)
     return *this;
@@ -6786,11 +13457,12 @@ replace(
   return *this;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<typename InputIterator>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 replace(
   const_iterator i1,
   const_iterator i2,
@@ -6801,7 +13473,7 @@ replace(
         InputIterator>::value &&
           !detail::is_forward_iterator<
             InputIterator>::value,
-              basic_static_string<N, CharT, Traits>&>::type
+              basic_static_string<N, CharT, Traits, OverflowPolicy>&>::type
 {
   const auto curr_size = size();
   const auto curr_data = data();
@@ -6818,10 +13490,11 @@ replace(
   return *this;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 find(
   const_pointer s,
   size_type pos,
@@ -6833,14 +13506,15 @@ find(
     return npos;
   if (!n)
     return pos;
-  const auto res = detail::search(data() + pos, data() + curr_size, s, s + n, traits_type::eq);
+  const auto res = detail::search_chars<Traits>(data() + pos, data() + curr_size, s, n);
   return res == end() ? npos : detail::distance(data(), res);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 rfind(
   const_pointer s,
   size_type pos,
@@ -6855,16 +13529,16 @@ rfind(
     pos = curr_size - n;
   if (!n)
     return pos;
-  for (auto sub = &curr_data[pos]; sub >= curr_data; --sub)
-    if (!traits_type::compare(sub, s, n))
-      return detail::distance(curr_data, sub);
-  return npos;
+  const auto last = &curr_data[pos + n];
+  const auto res = detail::rsearch_chars<Traits>(curr_data, last, s, n);
+  return res == last ? npos : detail::distance(curr_data, res);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 find_first_of(
   const_pointer s,
   size_type pos,
@@ -6874,14 +13548,15 @@ find_first_of(
   const auto curr_data = data();
   if (pos >= size() || !n)
     return npos;
-  const auto res = detail::find_first_of(&curr_data[pos], &curr_data[size()], s, &s[n], traits_type::eq);
+  const auto res = detail::find_of<true, false, Traits>(&curr_data[pos], &curr_data[size()], s, n);
   return res == end() ? npos : detail::distance(curr_data, res);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 find_last_of(
   const_pointer s,
   size_type pos,
@@ -6889,20 +13564,21 @@ find_last_of(
     size_type
 {
   const auto curr_size = size();
-  if (!n)
+  if (!n || !curr_size)
     return npos;
-  if (pos >= curr_size)
-    pos = 0;
-  else
-    pos = curr_size - (pos + 1);
-  const auto res = detail::find_first_of(rbegin() + pos, rend(), s, &s[n], traits_type::eq);
-  return res == rend() ? npos : curr_size - 1 - detail::distance(rbegin(), res);
+  const auto curr_data = data();
+  const auto last = &curr_data[(std::min)(pos, curr_size - 1) + 1];
+  const auto res = n == 1 ?
+    detail::rsearch_chars<Traits>(curr_data, last, s, 1) :
+    detail::find_of<true, true, Traits>(curr_data, last, s, n);
+  return res == last ? npos : detail::distance(curr_data, res);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 find_first_not_of(
   const_pointer s,
   size_type pos,
@@ -6913,14 +13589,15 @@ find_first_not_of(
     return npos;
   if (!n)
     return pos;
-  const auto res = detail::find_not_of<Traits>(data() + pos, data() + size(), s, n);
+  const auto res = detail::find_of<false, false, Traits>(data() + pos, data() + size(), s, n);
   return res == end() ? npos : detail::distance(data(), res);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 find_last_not_of(
   const_pointer s,
   size_type pos,
@@ -6932,16 +13609,20 @@ find_last_not_of(
     pos = curr_size - 1;
   if (!n)
     return pos;
-  pos = curr_size - (pos + 1);
-  const auto res = detail::find_not_of<Traits>(rbegin() + pos, rend(), s, n);
-  return res == rend() ? npos : curr_size - 1 - detail::distance(rbegin(), res);
+  const auto curr_data = data();
+  const auto last = &curr_data[pos + 1];
+  const auto res = n == 1 ?
+    detail::rfind_not_char<Traits>(curr_data, last, *s) :
+    detail::find_of<false, true, Traits>(curr_data, last, s, n);
+  return res == last ? npos : detail::distance(curr_data, res);
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 template<typename InputIterator>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 read_back(
   bool overwrite_null,
   InputIterator first,
@@ -6954,22 +13635,30 @@ read_back(
   {
     if (new_size >= max_size())
     {
-      // if we overwrote the null terminator,
-      // put it back
-      if (overwrite_null)
-        term();
-      detail::throw_exception<std::length_error>(
-        "count > max_size() - size()");
+      if (!overwrite_null)
+      {
+        report_overflow("count > max_size() - size()");
+        break;
+      }
+      // if we overwrote the null terminator, put it
+      // back in case the policy throws, and restore
+      // the first character read if it does not
+      const value_type ch = curr_data[size()];
+      term();
+      report_overflow("count > max_size() - size()");
+      traits_type::assign(curr_data[size()], ch);
+      break;
     }
     traits_type::assign(curr_data[new_size++ + (!overwrite_null)], *first);
   }
   return new_size - size();
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 replace_unchecked(
   const_iterator i1,
   const_iterator i2,
@@ -6981,19 +13670,20 @@ replace_unchecked(
   const auto curr_size = size();
   const std::size_t pos = i1 - curr_data;
   const std::size_t n1 = i2 - i1;
-  if (n2 > max_size() || curr_size - (std::min)(n1, curr_size - pos) >= max_size() - n2)
-    detail::throw_exception<std::length_error>(
-      "replaced string exceeds max_size()");
+  n2 = checked_count(n2,
+    max_size() - (curr_size - (std::min)(n1, curr_size - pos)),
+    "replaced string exceeds max_size()");
   traits_type::move(&curr_data[pos + n2], i2, (end() - i2) + 1);
   traits_type::copy(&curr_data[pos], s, n2);
   this->set_size((curr_size - n1) + n2);
   return *this;
 }
 
-template<std::size_t N, typename CharT, typename Traits>
+template<std::size_t N, typename CharT, typename Traits,
+  typename OverflowPolicy>
 BOOST_STATIC_STRING_CPP14_CONSTEXPR
 auto
-basic_static_string<N, CharT, Traits>::
+basic_static_string<N, CharT, Traits, OverflowPolicy>::
 insert_unchecked(
   const_iterator pos,
   const_pointer s,
@@ -7002,9 +13692,8 @@ insert_unchecked(
 {
   const auto curr_data = data();
   const auto curr_size = size();
-  if (count > max_size() - curr_size)
-    detail::throw_exception<std::length_error>(
-      "count > max_size() - curr_size");
+  count = checked_count(count, max_size() - curr_size,
+    "count > max_size() - curr_size");
   const std::size_t index = pos - curr_data;
   traits_type::move(&curr_data[index + count], pos, (end() - pos) + 1);
   traits_type::copy(&curr_data[index], s, count);
@@ -23,5 +23,34 @@ static_assert(!detail::is_forward_iterator<int>::value, "is_forward_iterator is
 static_assert(!detail::is_forward_iterator<double>::value, "is_forward_iterator is incorrect");
 static_assert(detail::is_forward_iterator<int*>::value, "is_forward_iterator is incorrect");
 static_assert(!detail::is_forward_iterator<std::istreambuf_iterator<char>>::value, "is_forward_iterator is incorrect");
+
+template<typename T, typename = void>
+struct is_concat_piece : std::false_type { };
+
+template<typename T>
+struct is_concat_piece<T, detail::void_t<decltype(
+  detail::concat_range<std::char_traits<char>, char>(
+    std::declval<const T&>()))>>
+  : std::true_type { };
+
+static_assert(is_concat_piece<char>::value, "concat_range is incorrect");
+static_assert(is_concat_piece<const char*>::value, "concat_range is incorrect");
+static_assert(is_concat_piece<static_string<4>>::value, "concat_range is incorrect");
+static_assert(!is_concat_piece<int>::value, "concat_range is incorrect");
+static_assert(!is_concat_piece<wchar_t>::value, "concat_range is incorrect");
+static_assert(!is_concat_piece<signed char>::value, "concat_range is incorrect");
+
+template<typename T, typename = void>
+struct has_precision_overload : std::false_type { };
+
+template<typename T>
+struct has_precision_overload<T, detail::void_t<decltype(
+  to_static_string(std::declval<T>(), 2))>>
+  : std::true_type { };
+
+static_assert(has_precision_overload<double>::value, "to_static_string is incorrect");
+static_assert(has_precision_overload<float>::value, "to_static_string is incorrect");
+static_assert(!has_precision_overload<int>::value, "to_static_string is incorrect");
+static_assert(!has_precision_overload<unsigned long long>::value, "to_static_string is incorrect");
 } // boost
 } // static_strings
\ No newline at end of file
@@ -70,6 +70,7 @@ testConstantEvaluation()
   // c++20 constexpr tests
   cstatic_string a;
   cstatic_string b(1, 'a');
+  cstatic_string{uninitialized};
   cstatic_string(b, 0);
   cstatic_string(b, 0, 1);
   cstatic_string("a", 1);
@@ -209,6 +210,7 @@ testConstantEvaluation()
   a.find("a", 0, 1);
   a.find("a", 0);
   a.find('a', 0);
+  a.find(static_string_searcher<char, cxper_char_traits>("a", 1));
 
   // rfind
   a.rfind(a);
@@ -397,6 +399,7 @@ testConstantEvaluation()
   a.find("a", 0, 1);
   a.find("a", 0);
   a.find('a', 0);
+  a.find(static_string_searcher<char, cxper_char_traits>("a", 1));
 
   // rfind
   a.rfind(a);
@@ -569,6 +572,7 @@ testConstantEvaluation()
   a.find("a", 0, 1);
   a.find("a", 0);
   a.find('a', 0);
+  a.find(static_string_searcher<char, cxper_char_traits>("a", 1));
 
   // rfind
   a.rfind(a);
@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2019-2020 Krystian Stasiowski (sdkrystian at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/static_string
+//
+
+// This file is built with exceptions disabled, and checks
+// that strings with a non-throwing overflow policy build
+// and work without them.
+
+#include <boost/static_string/static_string.hpp>
+
+namespace boost {
+namespace static_strings {
+
+using truncating_string = basic_static_string<
+  8, char, std::char_traits<char>, truncate_on_overflow>;
+
+using saturating_string = basic_static_string<
+  8, char, std::char_traits<char>, saturate_on_overflow>;
+
+int
+runTests()
+{
+  truncating_string t = "abc";
+  t.insert(t.begin(), 2, '-');
+  t.append("defghijk");
+  t.push_back('x');
+  t.resize(16, '.');
+  if (t != "--abcdef")
+    return 1;
+  t.replace(t.begin(), t.begin() + 2, 3, '*');
+  if (t != "**abcdef")
+    return 1;
+
+  saturating_string s = "abc";
+  s.append_number(123456);
+  s += 'x';
+  if (s != "abcx" || !s.overflow_policy().overflowed())
+    return 1;
+
+  if (to_static_string(42) != "42")
+    return 1;
+  if (to_static_string_base(255, 16) != "ff")
+    return 1;
+  return 0;
+}
+
+} // static_strings
+} // boost
+
+int
+main()
+{
+  return boost::static_strings::runTests();
+}
@@ -15,11 +15,19 @@
 
 #include <boost/core/lightweight_test.hpp>
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <cwchar>
 #include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <map>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace static_strings {
@@ -248,11 +256,19 @@ bool
 testTS(Arithmetic value, const char* str_expected = "", bool test_expected = false)
 {
   const auto str = to_static_string(value);
-  if (std::is_floating_point<Arithmetic>::value)
+  if (std::is_same<Arithmetic, long double>::value)
   {
     const auto std_res = std::to_string(value);
     return str == std_res.data();
   }
+  else if (std::is_floating_point<Arithmetic>::value)
+  {
+    // the shortest string that reads back as value
+    const Arithmetic back = std::is_same<Arithmetic, float>::value ?
+      Arithmetic(std::strtof(str.begin(), nullptr)) :
+      Arithmetic(std::strtod(str.begin(), nullptr));
+    return back == value && (! test_expected || str == str_expected);
+  }
   else
   {
     if (std::is_signed<Arithmetic>::value)
@@ -274,11 +290,18 @@ bool
 testTWS(Arithmetic value, const wchar_t* wstr_expected = L"", bool test_expected = false)
 {
   const auto wstr = to_static_wstring(value);
-  if (std::is_floating_point<Arithmetic>::value)
+  if (std::is_same<Arithmetic, long double>::value)
   {
     const auto wstd_res = std::to_wstring(value);
     return wstr == wstd_res.data();
   }
+  else if (std::is_floating_point<Arithmetic>::value)
+  {
+    const Arithmetic back = std::is_same<Arithmetic, float>::value ?
+      Arithmetic(std::wcstof(wstr.begin(), nullptr)) :
+      Arithmetic(std::wcstod(wstr.begin(), nullptr));
+    return back == value && (! test_expected || wstr == wstr_expected);
+  }
   else
   {
     if (std::is_signed<Arithmetic>::value)
@@ -369,6 +392,19 @@ testConstruct()
             (static_string<4>(s1)),
             std::length_error);
     }
+    {
+        static_string<5> s1("12345");
+        static_string<5> s2(std::move(s1));
+        BOOST_TEST(s2 == "12345");
+        BOOST_TEST(*s2.end() == 0);
+        static_string<5> s3;
+        s3 = std::move(s2);
+        BOOST_TEST(s3 == "12345");
+        BOOST_TEST(*s3.end() == 0);
+        static_string<0> s4;
+        static_string<0> s5(std::move(s4));
+        BOOST_TEST(s5.empty());
+    }
     {
         static_string<3> s1({'1', '2', '3'});
         BOOST_TEST(s1 == "123");
@@ -2342,6 +2378,80 @@ testAppend()
   BOOST_TEST(s_short == "123/123/123/123/123/123/123/123/");
 }
 
+// done
+static
+void
+testAppendNumber()
+{
+  // append_number(Integer value, int base = 10)
+  BOOST_TEST(static_string<8>{"x="}.append_number(0) == "x=0");
+  BOOST_TEST(static_string<8>{"x="}.append_number(-42) == "x=-42");
+  BOOST_TEST(static_string<8>{"x="}.append_number(12345u) == "x=12345");
+  BOOST_TEST(static_string<8>{}.append_number(255, 16) == "ff");
+  BOOST_TEST(static_string<9>{}.append_number(-255, 2) == "-11111111");
+  BOOST_TEST(static_string<8>{}.append_number(35, 36) == "z");
+  BOOST_TEST(static_string<20>{}.append_number(
+    (std::numeric_limits<long long>::min)()) == "-9223372036854775808");
+  BOOST_TEST(static_string<20>{}.append_number(
+    (std::numeric_limits<unsigned long long>::max)()) == "18446744073709551615");
+  BOOST_TEST(static_string<4>{}.append_number(
+    (std::numeric_limits<signed char>::min)()) == "-128");
+  BOOST_TEST(static_string<5>{"ab"}.append_number(999) == "ab999");
+  BOOST_TEST_THROWS(static_string<5>{"ab"}.append_number(1000), std::length_error);
+  BOOST_TEST_THROWS(static_string<5>{"ab"}.append_number(-100), std::length_error);
+  BOOST_TEST_THROWS(static_string<0>{}.append_number(0), std::length_error);
+  BOOST_TEST_THROWS(static_string<8>{}.append_number(5, 0), std::invalid_argument);
+  BOOST_TEST_THROWS(static_string<8>{}.append_number(5, 1), std::invalid_argument);
+  BOOST_TEST_THROWS(static_string<8>{}.append_number(-5, 37), std::invalid_argument);
+  {
+    static_string<32> s;
+    for (unsigned i = 1; i <= 100000; i *= 10)
+    {
+      s.clear();
+      BOOST_TEST(s.append_number(i - 1) == std::to_string(i - 1).c_str());
+      s.clear();
+      BOOST_TEST(s.append_number(i) == std::to_string(i).c_str());
+    }
+    s = "abc";
+    s.append_number(7).append_number(-8);
+    BOOST_TEST(s == "abc7-8");
+    BOOST_TEST(s.size() == 6);
+    BOOST_TEST(s.c_str()[6] == '\0');
+  }
+  BOOST_TEST(static_wstring<8>{L"x="}.append_number(-42) == L"x=-42");
+  BOOST_TEST(static_wstring<8>{}.append_number(0xbeefu, 16) == L"beef");
+
+  // append_float(Float value)
+  BOOST_TEST(static_string<32>{"x="}.append_float(0.1) == "x=0.1");
+  BOOST_TEST(static_string<32>{}.append_float(-1.5f) == "-1.5");
+  BOOST_TEST(static_string<32>{}.append_float(1e300) == "1e+300");
+  BOOST_TEST(static_string<32>{}.append_float(
+    std::numeric_limits<double>::infinity()) == "inf");
+  BOOST_TEST(static_string<32>{}.append_float(
+    (std::numeric_limits<double>::max)()) == "1.7976931348623157e+308");
+  // formatted through a buffer when the worst case does not fit
+  BOOST_TEST(static_string<5>{"ab"}.append_float(0.5) == "ab0.5");
+  BOOST_TEST(static_string<4>{}.append_float(-0.0) == "-0");
+  BOOST_TEST_THROWS(static_string<5>{"ab"}.append_float(0.25), std::length_error);
+  BOOST_TEST_THROWS(static_string<0>{}.append_float(0.0f), std::length_error);
+  {
+    static_string<5> s{"ab"};
+    BOOST_TEST_THROWS(s.append_float(123.5), std::length_error);
+    BOOST_TEST(s == "ab");
+  }
+
+  // append_float(Float value, int precision)
+  BOOST_TEST(static_string<32>{}.append_float(3.14159, 3) == "3.14");
+  BOOST_TEST(static_string<32>{}.append_float(1234567.0, 3) == "1.23e+06");
+  BOOST_TEST(static_string<32>{}.append_float(0.1, 17) == "0.10000000000000001");
+  BOOST_TEST(static_string<32>{}.append_float(2.5f, 0) == "2");
+  BOOST_TEST(static_string<4>{"a"}.append_float(2.75, 2) == "a2.8");
+  BOOST_TEST_THROWS(static_string<4>{"a"}.append_float(2.75, 3), std::length_error);
+
+  BOOST_TEST(static_wstring<32>{L"x="}.append_float(0.1) == L"x=0.1");
+  BOOST_TEST(static_wstring<32>{}.append_float(1.0 / 3, 4) == L"0.3333");
+}
+
 // done
 static
 void
@@ -3752,6 +3862,62 @@ testCompare()
     BOOST_TEST(testC(S("abcdefghijklmnopqrst"), 21, 0, "abcdefghijklmnopqrst", 20, 0));
 }
 
+template<typename CharT>
+void
+testEqualityImpl()
+{
+  using S = basic_static_string<80, CharT>;
+  // sizes around each block width, differing at every position
+  for (std::size_t n = 0; n <= 70; ++n)
+  {
+    S a;
+    for (std::size_t i = 0; i < n; ++i)
+      a.push_back(CharT('a' + i % 26));
+    const basic_static_string<90, CharT> b(a.data(), a.size());
+    BOOST_TEST(a == b);
+    BOOST_TEST(!(a != b));
+    BOOST_TEST(a == b.c_str());
+    BOOST_TEST(b.c_str() == a);
+    BOOST_TEST(!(a != b.c_str()));
+    BOOST_TEST(!(b.c_str() != a));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      S c = a;
+      c[i] = CharT('A');
+      BOOST_TEST(!(a == c));
+      BOOST_TEST(a != c);
+      BOOST_TEST(!(c.c_str() == a));
+      BOOST_TEST(a != c.c_str());
+    }
+    S d = a;
+    d.push_back(CharT('a'));
+    BOOST_TEST(!(a == d));
+    BOOST_TEST(d != a);
+    BOOST_TEST(!(a.c_str() == d));
+    BOOST_TEST(d != a.c_str());
+  }
+}
+
+void
+testEquality()
+{
+  testEqualityImpl<char>();
+  testEqualityImpl<char16_t>();
+  testEqualityImpl<char32_t>();
+
+  const static_string<40> s = "0123456789012345678901234567890123456789";
+  const string_like same(s.data(), s.size());
+  const string_like shorter(s.data(), s.size() - 1);
+  BOOST_TEST(s == same);
+  BOOST_TEST(same == s);
+  BOOST_TEST(!(s != same));
+  BOOST_TEST(!(same != s));
+  BOOST_TEST(!(s == shorter));
+  BOOST_TEST(!(shorter == s));
+  BOOST_TEST(s != shorter);
+  BOOST_TEST(shorter != s);
+}
+
 // done
 void
 testSwap()
@@ -3800,6 +3966,36 @@ testSwap()
                 std::length_error);
         }
     }
+    {
+        static_string<3> s1("123");
+        s1.swap(s1);
+        BOOST_TEST(s1 == "123");
+        BOOST_TEST(*s1.end() == 0);
+        static_string<0> s2;
+        static_string<0> s3;
+        swap(s2, s3);
+        BOOST_TEST(s2.empty());
+        BOOST_TEST(s3.empty());
+    }
+    {
+        // prefixes longer than a single swap block
+        static_string<300> s1(200, 'a');
+        static_string<300> s2(150, 'b');
+        s2.append(70, 'c');
+        swap(s1, s2);
+        BOOST_TEST(s1.size() == 220);
+        BOOST_TEST(s2 == static_string<300>(200, 'a'));
+        BOOST_TEST(s1.substr(0, 150) == static_string<300>(150, 'b'));
+        BOOST_TEST(s1.substr(150) == static_string<300>(70, 'c'));
+        BOOST_TEST(*s1.end() == 0);
+        BOOST_TEST(*s2.end() == 0);
+        static_string<250> s3;
+        swap(s1, s3);
+        BOOST_TEST(s1.empty());
+        BOOST_TEST(*s1.end() == 0);
+        BOOST_TEST(s3.size() == 220);
+        BOOST_TEST(*s3.end() == 0);
+    }
 }
 
 void
@@ -3946,21 +4142,196 @@ testToStaticString()
     BOOST_TEST(testTS(-4294967295ll, "-4294967295", true));
     BOOST_TEST(testTS(1, "1", true));
     BOOST_TEST(testTS(-1, "-1", true));
-    BOOST_TEST(testTS(0.1));
-    BOOST_TEST(testTS(0.0000001));
-    BOOST_TEST(testTS(-0.0000001));
-    BOOST_TEST(testTS(-0.1));
-    BOOST_TEST(testTS(1234567890.0001));
-    BOOST_TEST(testTS(1.123456789012345));
-    BOOST_TEST(testTS(-1234567890.1234));
-    BOOST_TEST(testTS(-1.123456789012345));
+    BOOST_TEST(testTS(0.1, "0.1", true));
+    BOOST_TEST(testTS(0.0000001, "1e-07", true));
+    BOOST_TEST(testTS(-0.0000001, "-1e-07", true));
+    BOOST_TEST(testTS(-0.1, "-0.1", true));
+    BOOST_TEST(testTS(1234567890.0001, "1234567890.0001", true));
+    BOOST_TEST(testTS(1.123456789012345, "1.123456789012345", true));
+    BOOST_TEST(testTS(-1234567890.1234, "-1234567890.1234", true));
+    BOOST_TEST(testTS(-1.123456789012345, "-1.123456789012345", true));
+    BOOST_TEST(testTS(0.1f, "0.1", true));
+    BOOST_TEST(testTS(1.f / 3, "0.33333334", true));
 
     BOOST_TEST(testTS(std::numeric_limits<long long>::max()));
     BOOST_TEST(testTS(std::numeric_limits<long long>::min()));
     BOOST_TEST(testTS(std::numeric_limits<unsigned long long>::max()));
     BOOST_TEST(testTS(std::numeric_limits<unsigned long long>::max()));
     BOOST_TEST(testTS(std::numeric_limits<long double>::min()));
-    BOOST_TEST(testTS(std::numeric_limits<float>::min()));
+    BOOST_TEST(testTS(std::numeric_limits<float>::min(), "1.1754944e-38", true));
+    BOOST_TEST(testTS(std::numeric_limits<int>::max()));
+    BOOST_TEST(testTS(std::numeric_limits<int>::min()));
+    BOOST_TEST(testTS(std::numeric_limits<long>::min()));
+
+    // every number of digits, and both sides of each power of ten
+    for (unsigned long long p = 1; p <= 1000000000000000000ull; p *= 10)
+    {
+      for (unsigned long long v : {p - 1, p, p + 1, p * 9 + 7})
+      {
+        BOOST_TEST(to_static_string(v) == std::to_string(v).c_str());
+        const auto sv = -static_cast<long long>(v);
+        BOOST_TEST(to_static_string(sv) == std::to_string(sv).c_str());
+        if (v <= (std::numeric_limits<unsigned>::max)())
+          BOOST_TEST(to_static_string(unsigned(v)) ==
+            std::to_string(unsigned(v)).c_str());
+      }
+    }
+
+    // shortest round trip floating point
+    BOOST_TEST(to_static_string(0.0) == "0");
+    BOOST_TEST(to_static_string(-0.0) == "-0");
+    BOOST_TEST(to_static_string(1e-10) == "1e-10");
+    BOOST_TEST(to_static_string(1e21) == "1e+21");
+    BOOST_TEST(to_static_string(1e15) == "1e+15");
+    BOOST_TEST(to_static_string(123456.0) == "123456");
+    BOOST_TEST(to_static_string(2.0 / 3) == "0.6666666666666666");
+    BOOST_TEST(to_static_string(5e-324) == "5e-324");
+    BOOST_TEST(to_static_string(9007199254740993.0) == "9007199254740992");
+    BOOST_TEST(to_static_string(123456789012345680000.0) ==
+      "123456789012345683968");
+    BOOST_TEST(to_static_string(16777216.f) == "16777216");
+    BOOST_TEST(to_static_string(
+      std::numeric_limits<float>::max()) == "3.4028235e+38");
+    BOOST_TEST(to_static_string(
+      std::numeric_limits<double>::infinity()) == "inf");
+    BOOST_TEST(to_static_string(
+      -std::numeric_limits<double>::infinity()) == "-inf");
+    BOOST_TEST(to_static_string(
+      std::numeric_limits<double>::quiet_NaN()).ends_with("nan"));
+    // the longest strings still fit
+    BOOST_TEST(to_static_string(
+      std::numeric_limits<double>::max()) == "1.7976931348623157e+308");
+    BOOST_TEST(to_static_string(
+      -std::numeric_limits<double>::min()) == "-2.2250738585072014e-308");
+    BOOST_TEST(to_static_string(
+      -std::numeric_limits<float>::min()) == "-1.1754944e-38");
+    BOOST_TEST(to_static_string(-1.0000001e-10f) == "-1.0000001e-10");
+    BOOST_TEST(to_static_string(-0.00012345678901234567) ==
+      "-0.00012345678901234567");
+    static_assert(decltype(to_static_string(1.0))::static_capacity == 24, "");
+    static_assert(decltype(to_static_string(1.f))::static_capacity == 16, "");
+    {
+      // every finite value reads back
+      std::uint64_t bits = 0x9e3779b97f4a7c15ull;
+      for (int i = 0; i < 10000; ++i)
+      {
+        bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        if (std::isfinite(v))
+          BOOST_TEST(testTS(v));
+        float f;
+        const std::uint32_t half = static_cast<std::uint32_t>(bits >> 32);
+        std::memcpy(&f, &half, sizeof(f));
+        if (std::isfinite(f))
+          BOOST_TEST(testTS(f));
+      }
+    }
+    for (int e = -300; e <= 300; e += 7)
+    {
+      const std::string exp = "e" + std::to_string(e);
+      BOOST_TEST(testTS(std::strtod(("1.5" + exp).c_str(), nullptr)));
+      BOOST_TEST(testTS(std::strtod(("-0.123456789" + exp).c_str(), nullptr)));
+    }
+    for (int e = -37; e <= 37; ++e)
+      BOOST_TEST(testTS(std::pow(10.f, float(e)) / 3));
+
+    // with a precision, like %.*g
+    BOOST_TEST(to_static_string(3.14159265, 3) == "3.14");
+    BOOST_TEST(to_static_string(1234567.0, 3) == "1.23e+06");
+    BOOST_TEST(to_static_string(0.0001, 2) == "0.0001");
+    BOOST_TEST(to_static_string(0.00001234, 2) == "1.2e-05");
+    BOOST_TEST(to_static_string(0.5, 0) == "0.5");
+    BOOST_TEST(to_static_string(2.5, 1) == "2");
+    BOOST_TEST(to_static_string(3.5, 1) == "4");
+    BOOST_TEST(to_static_string(9.96, 2) == "10");
+    BOOST_TEST(to_static_string(0.1, 17) == "0.10000000000000001");
+    BOOST_TEST(to_static_string(0.1, 100) == "0.10000000000000001");
+    BOOST_TEST(to_static_string(100.0, 17) == "100");
+    BOOST_TEST(to_static_string(1e100, 5) == "1e+100");
+    BOOST_TEST(to_static_string(-0.0, 3) == "-0");
+    BOOST_TEST(to_static_string(
+      -std::numeric_limits<double>::infinity(), 3) == "-inf");
+    BOOST_TEST(to_static_string(
+      -std::numeric_limits<double>::min(), 17) == "-2.2250738585072014e-308");
+    BOOST_TEST(to_static_string(0.1f, 9) == "0.100000001");
+    BOOST_TEST(to_static_string(
+      std::numeric_limits<float>::max(), 9) == "3.40282347e+38");
+    for (int p = 1; p <= 17; ++p)
+    {
+      for (double v : {1.0 / 3, 2.0 / 3 * 1e-5, 123456.789, 9.5, 1e300 / 7})
+      {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%.*g", p, v);
+        BOOST_TEST(to_static_string(v, p) == buf);
+      }
+    }
+
+    // with a base, width and fill
+    BOOST_TEST(to_static_string_base(255, 16) == "ff");
+    BOOST_TEST(to_static_string_base(255, 16, 8) == "000000ff");
+    BOOST_TEST(to_static_string_base(-255, 16, 6) == "-000ff");
+    BOOST_TEST(to_static_string_base(-255, 16, 6, ' ') == "   -ff");
+    BOOST_TEST(to_static_string_base(-255, 16, 2) == "-ff");
+    BOOST_TEST(to_static_string_base(0, 16) == "0");
+    BOOST_TEST_THROWS(to_static_string_base(5, 0), std::invalid_argument);
+    BOOST_TEST_THROWS(to_static_string_base(5u, 1), std::invalid_argument);
+    BOOST_TEST_THROWS(to_static_string_base(-5ll, 37), std::invalid_argument);
+    BOOST_TEST(to_static_string_base(short(-255), 16) == "-ff");
+    static_assert(decltype(to_static_string_base(short(1), 2))::static_capacity ==
+      std::numeric_limits<short>::digits + 2, "");
+    BOOST_TEST(to_static_string_base(0u, 2, 4) == "0000");
+    BOOST_TEST(to_static_string_base(5, 2) == "101");
+    BOOST_TEST(to_static_string_base(8l, 8) == "10");
+    BOOST_TEST(to_static_string_base(35ll, 36) == "z");
+    BOOST_TEST(to_static_string_base(-35ll, 36) == "-z");
+    BOOST_TEST(to_static_string_base(12345, 10, 8, ' ') == "   12345");
+    BOOST_TEST(to_static_string_base(0xdeadbeefu, 16, 0, ' ') == "deadbeef");
+    BOOST_TEST(to_static_string_base(1u, 10, 1000) ==
+      std::string(std::numeric_limits<unsigned>::digits - 1, '0') + "1");
+    BOOST_TEST(to_static_string_base((std::numeric_limits<int>::min)(), 2) ==
+      "-1" + std::string(std::numeric_limits<int>::digits, '0'));
+    BOOST_TEST(to_static_string_base(
+      (std::numeric_limits<unsigned long long>::max)(), 2) ==
+        std::string(std::numeric_limits<unsigned long long>::digits, '1'));
+    BOOST_TEST(to_static_string_base(
+      (std::numeric_limits<long long>::min)(), 16) == "-8000000000000000");
+    BOOST_TEST(to_integer<unsigned long>(to_static_string_base(
+      (std::numeric_limits<unsigned long>::max)(), 3), 3).value ==
+        (std::numeric_limits<unsigned long>::max)());
+    static_assert(decltype(to_static_string_base(1, 2))::static_capacity ==
+      std::numeric_limits<int>::digits + 2, "");
+    static_assert(decltype(to_static_string_base(1u, 2))::static_capacity ==
+      std::numeric_limits<unsigned>::digits, "");
+    for (unsigned long long v = 1; v; v = v * 3 + 1)
+    {
+      char buf[64];
+      std::snprintf(buf, sizeof(buf), "%llx", v);
+      BOOST_TEST(to_static_string_base(v, 16) == buf);
+      std::snprintf(buf, sizeof(buf), "%llo", v);
+      BOOST_TEST(to_static_string_base(v, 8) == buf);
+      std::snprintf(buf, sizeof(buf), "%024llx", v);
+      BOOST_TEST(to_static_string_base(v, 16, 24) == buf);
+      std::snprintf(buf, sizeof(buf), "%lld", -static_cast<long long>(v / 2));
+      BOOST_TEST(to_static_string_base(-static_cast<long long>(v / 2), 10) == buf);
+      BOOST_TEST(to_integer<unsigned long long>(
+        to_static_string_base(v, 2), 2).value == v);
+      BOOST_TEST(to_integer<unsigned long long>(
+        to_static_string_base(v, 7), 7).value == v);
+      if (v > (std::numeric_limits<unsigned long long>::max)() / 3)
+        break;
+    }
+
+#ifdef BOOST_STATIC_STRING_CPP20
+    static_assert(to_static_string_base(255, 16, 4) == "00ff");
+    static_assert(to_static_string_base(-5, 2) == "-101");
+    static_assert(to_static_string(0) == "0");
+    static_assert(to_static_string(-1234567) == "-1234567");
+    static_assert(to_static_string(
+      std::numeric_limits<long long>::min()) == "-9223372036854775808");
+    static_assert(to_static_string(18446744073709551615ull) ==
+      "18446744073709551615");
+#endif
 
     // these tests technically are not portable, but they will work
     // 99% of the time.
@@ -3992,21 +4363,30 @@ testToStaticString()
     BOOST_TEST(testTWS(-4294967295ll, L"-4294967295", true));
     BOOST_TEST(testTWS(1, L"1", true));
     BOOST_TEST(testTWS(-1, L"-1", true));
-    BOOST_TEST(testTWS(0.1));
-    BOOST_TEST(testTWS(0.0000001));
-    BOOST_TEST(testTWS(-0.0000001));
-    BOOST_TEST(testTWS(-0.1));
-    BOOST_TEST(testTWS(1234567890.0001));
-    BOOST_TEST(testTWS(1.123456789012345));
-    BOOST_TEST(testTWS(-1234567890.1234));
-    BOOST_TEST(testTWS(-1.123456789012345));
+    BOOST_TEST(testTWS(0.1, L"0.1", true));
+    BOOST_TEST(testTWS(0.0000001, L"1e-07", true));
+    BOOST_TEST(testTWS(-0.0000001, L"-1e-07", true));
+    BOOST_TEST(testTWS(-0.1, L"-0.1", true));
+    BOOST_TEST(testTWS(1234567890.0001, L"1234567890.0001", true));
+    BOOST_TEST(testTWS(1.123456789012345, L"1.123456789012345", true));
+    BOOST_TEST(testTWS(-1234567890.1234, L"-1234567890.1234", true));
+    BOOST_TEST(testTWS(-1.123456789012345, L"-1.123456789012345", true));
+    BOOST_TEST(testTWS(0.1f, L"0.1", true));
+    BOOST_TEST(testTWS(1.f / 3, L"0.33333334", true));
 
     BOOST_TEST(testTWS(std::numeric_limits<long long>::max()));
     BOOST_TEST(testTWS(std::numeric_limits<long long>::min()));
     BOOST_TEST(testTWS(std::numeric_limits<unsigned long long>::max()));
     BOOST_TEST(testTWS(std::numeric_limits<unsigned long long>::max()));
     BOOST_TEST(testTWS(std::numeric_limits<long double>::min()));
-    BOOST_TEST(testTWS(std::numeric_limits<float>::min()));
+    BOOST_TEST(testTWS(std::numeric_limits<float>::min(), L"1.1754944e-38", true));
+    BOOST_TEST(to_static_wstring(1e21) == L"1e+21");
+    BOOST_TEST(to_static_wstring_base(-255, 16, 6) == L"-000ff");
+    BOOST_TEST(to_static_wstring_base(255u, 2, 10, L' ') == L"  11111111");
+    BOOST_TEST_THROWS(to_static_wstring_base(255u, 37), std::invalid_argument);
+    BOOST_TEST(to_static_wstring(-2.5e-300) == L"-2.5e-300");
+    BOOST_TEST(to_static_wstring(1234567.0, 3) == L"1.23e+06");
+    BOOST_TEST(to_static_wstring(0.1f, 9) == L"0.100000001");
 
     {
       auto str = to_static_wstring(std::numeric_limits<float>::max());
@@ -4026,6 +4406,162 @@ testToStaticString()
 #endif
 }
 
+void
+testToNumber()
+{
+  // integers
+  {
+    auto r = to_integer<int>(static_string<16>("12345"));
+    BOOST_TEST(r.value == 12345 && r.size == 5 && r.ec == std::errc());
+  }
+  {
+    auto r = to_integer<int>(static_string<16>("-42abc"));
+    BOOST_TEST(r.value == -42 && r.size == 3 && r.ec == std::errc());
+  }
+  {
+    auto r = to_integer<unsigned>(static_string<16>("-42"));
+    BOOST_TEST(r.value == 0 && r.size == 0 &&
+      r.ec == std::errc::invalid_argument);
+  }
+  BOOST_TEST(to_integer<int>(static_string<16>("+1")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_integer<int>(static_string<16>(" 1")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_integer<int>(static_string<16>("")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_integer<int>(static_string<16>("-")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_integer<int>(static_string<16>("-0")).value == 0);
+  BOOST_TEST(to_integer<int>(static_string<16>("ff"), 16).value == 255);
+  BOOST_TEST(to_integer<int>(static_string<16>("-FF"), 16).value == -255);
+  BOOST_TEST(to_integer<int>(static_string<16>("z"), 36).value == 35);
+  BOOST_TEST(to_integer<int>(static_string<16>("1012"), 2).size == 3);
+  BOOST_TEST(to_integer<int>(static_string<16>("1"), 1).ec ==
+    std::errc::invalid_argument);
+  {
+    auto r = to_integer<signed char>(static_string<16>("-128"));
+    BOOST_TEST(r.value == -128 && r.ec == std::errc());
+    r = to_integer<signed char>(static_string<16>("128"));
+    BOOST_TEST(r.size == 3 && r.ec == std::errc::result_out_of_range);
+  }
+  {
+    auto r = to_integer<long long>(
+      static_string<32>("-9223372036854775808"));
+    BOOST_TEST(r.value == (std::numeric_limits<long long>::min)() &&
+      r.size == 20 && r.ec == std::errc());
+    r = to_integer<long long>(static_string<32>("9223372036854775808"));
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+  }
+  {
+    auto r = to_integer<unsigned long long>(
+      static_string<32>("18446744073709551615x"));
+    BOOST_TEST(r.value == 18446744073709551615ull &&
+      r.size == 20 && r.ec == std::errc());
+    r = to_integer<unsigned long long>(
+      static_string<32>("18446744073709551616"));
+    BOOST_TEST(r.size == 20 && r.ec == std::errc::result_out_of_range);
+    r = to_integer<unsigned long long>(
+      static_string<40>("000000000000000000000000000001"));
+    BOOST_TEST(r.value == 1 && r.size == 30);
+  }
+  // every length, against the formatting functions
+  for (unsigned long long v = 1, p = 0; p < 20; ++p, v = v * 10 + p % 10)
+  {
+    BOOST_TEST(to_integer<unsigned long long>(
+      to_static_string(v)).value == v);
+    BOOST_TEST(to_integer<long long>(to_static_string(
+      -static_cast<long long>(v / 2))).value ==
+        -static_cast<long long>(v / 2));
+    BOOST_TEST(to_integer<unsigned>(
+      to_static_string(v)).ec == (v > 4294967295ull ?
+        std::errc::result_out_of_range : std::errc()));
+  }
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+  BOOST_TEST(to_integer<int>(static_wstring<16>(L"-123")).value == -123);
+#endif
+#ifdef BOOST_STATIC_STRING_CPP20
+  static_assert(to_integer<int>(static_string<8>("-1234")).value == -1234);
+  static_assert(to_integer<unsigned>(static_string<8>("1x")).size == 1);
+#endif
+
+  // floating point
+  {
+    auto r = to_floating<double>(static_string<16>("3.25"));
+    BOOST_TEST(r.value == 3.25 && r.size == 4 && r.ec == std::errc());
+  }
+  {
+    auto r = to_floating<double>(static_string<16>("-1.5e3x"));
+    BOOST_TEST(r.value == -1500 && r.size == 6 && r.ec == std::errc());
+  }
+  BOOST_TEST(to_floating<double>(static_string<16>("1e")).size == 1);
+  BOOST_TEST(to_floating<double>(static_string<16>("1e+")).size == 1);
+  BOOST_TEST(to_floating<double>(static_string<16>("1.")).size == 2);
+  BOOST_TEST(to_floating<double>(static_string<16>(".5")).value == 0.5);
+  BOOST_TEST(to_floating<double>(static_string<16>(".")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_floating<double>(static_string<16>("+1")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_floating<double>(static_string<16>("e5")).ec ==
+    std::errc::invalid_argument);
+  BOOST_TEST(to_floating<double>(static_string<16>("0x1p3")).size == 1);
+  BOOST_TEST(to_floating<double>(static_string<16>("-0")).value == 0);
+  BOOST_TEST(std::signbit(
+    to_floating<double>(static_string<16>("-0.0")).value));
+  {
+    auto r = to_floating<double>(static_string<16>("-Infinity"));
+    BOOST_TEST(r.value == -std::numeric_limits<double>::infinity() &&
+      r.size == 9);
+    r = to_floating<double>(static_string<16>("infinit"));
+    BOOST_TEST(std::isinf(r.value) && r.size == 3);
+    r = to_floating<double>(static_string<16>("nan(0x1f)"));
+    BOOST_TEST(std::isnan(r.value) && r.size == 9);
+    r = to_floating<double>(static_string<16>("NaN(x"));
+    BOOST_TEST(std::isnan(r.value) && r.size == 3);
+  }
+  {
+    auto r = to_floating<double>(static_string<16>("1e400"));
+    BOOST_TEST(r.size == 5 && r.ec == std::errc::result_out_of_range);
+    r = to_floating<double>(static_string<16>("1e-400"));
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = to_floating<double>(static_string<16>("0e999999"));
+    BOOST_TEST(r.value == 0 && r.ec == std::errc());
+    r = to_floating<double>(static_string<16>("4e-324"));
+    BOOST_TEST(r.value == 5e-324 && r.ec == std::errc());
+  }
+  BOOST_TEST(to_floating<float>(static_string<16>("0.1")).value == 0.1f);
+  BOOST_TEST(to_floating<float>(static_string<16>("3.4e39")).ec ==
+    std::errc::result_out_of_range);
+  BOOST_TEST(to_floating<long double>(static_string<16>("0.5")).value ==
+    0.5L);
+  // halfway between two doubles, decided by the last digit
+  BOOST_TEST(to_floating<double>(static_string<32>(
+    "9007199254740993")).value == 9007199254740992.0);
+  BOOST_TEST(to_floating<double>(static_string<32>(
+    "9007199254740993.0000000001")).value == 9007199254740994.0);
+  {
+    static_string<1024> s("0.");
+    s.append(1000, '0');
+    s.push_back('1');
+    BOOST_TEST(to_floating<double>(s).ec ==
+      std::errc::result_out_of_range);
+    s.assign("1");
+    s.append(1000, '0');
+    s.append("e-1000");
+    BOOST_TEST(to_floating<double>(s).value == 1);
+  }
+  // round trip of the formatting functions
+  for (double v : {0.1, 1.0 / 3, 123456.789e100, 2.2250738585072014e-308,
+      5e-324, 1.7976931348623157e+308, 9007199254740993.0})
+  {
+    BOOST_TEST(to_floating<double>(to_static_string(v, 17)).value == v);
+    BOOST_TEST(to_floating<double>(to_static_string(-v, 17)).value == -v);
+  }
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+  BOOST_TEST(to_floating<double>(static_wstring<16>(L"-2.5e-1")).value ==
+    -0.25);
+#endif
+}
+
 // done
 void
 testFind()
@@ -6049,6 +6585,233 @@ testFind()
   BOOST_TEST(testFLN(S("hnbrcplsjfgiktoedmaq"), "qprlsfojamgndekthibc", 21, 20, S::npos));
 }
 
+// Exercises the block-wise search paths
+// with haystacks spanning several blocks
+void
+testFindLong()
+{
+  using S = static_string<300>;
+  // a small alphabet produces many partial matches
+  std::string hay;
+  unsigned state = 1;
+  for (std::size_t i = 0; i < 300; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    hay.push_back("abc"[(state >> 16) % 3]);
+  }
+  for (std::size_t len = 0; len <= hay.size(); len += 7)
+  {
+    const S s(hay.data(), len);
+    const std::string ref(hay.data(), len);
+    for (std::size_t n = 1; n <= 40; n += 3)
+    {
+      for (std::size_t start = 0; start + n <= hay.size(); start += 29)
+      {
+        const std::string needle = hay.substr(start, n);
+        for (std::size_t pos = 0; pos <= len; pos += 37)
+          BOOST_TEST_EQ(s.find(needle.data(), pos, n), ref.find(needle, pos));
+      }
+      BOOST_TEST_EQ(s.find(std::string(n, 'd').c_str()), ref.find(std::string(n, 'd')));
+    }
+  }
+  // a match at the very end of the string
+  S s(299, 'a');
+  s.push_back('b');
+  BOOST_TEST_EQ(s.find("ab"), 298u);
+  BOOST_TEST_EQ(s.find("aab"), 297u);
+  BOOST_TEST_EQ(s.find("b"), 299u);
+  BOOST_TEST(s.find("ba") == S::npos);
+}
+
+template<typename CharT>
+void
+testRFindLongImpl()
+{
+  using S = basic_static_string<300, CharT>;
+  using R = std::basic_string<CharT>;
+  // a small alphabet produces many partial matches
+  R hay;
+  unsigned state = 1;
+  for (std::size_t i = 0; i < 300; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    hay.push_back(CharT('a' + (state >> 16) % 3));
+  }
+  for (std::size_t len = 0; len <= hay.size(); len += 7)
+  {
+    const S s(hay.data(), len);
+    const R ref(hay.data(), len);
+    for (std::size_t n = 1; n <= 40; n += 3)
+    {
+      for (std::size_t start = 0; start + n <= hay.size(); start += 29)
+      {
+        const R needle = hay.substr(start, n);
+        for (std::size_t pos = 0; pos <= len; pos += 37)
+          BOOST_TEST_EQ(s.rfind(needle.data(), pos, n), ref.rfind(needle, pos));
+        BOOST_TEST_EQ(s.rfind(needle.data(), R::npos, n), ref.rfind(needle));
+      }
+    }
+    for (CharT c = 'a'; c <= 'd'; ++c)
+    {
+      for (std::size_t pos = 0; pos <= len; pos += 11)
+      {
+        BOOST_TEST_EQ(s.rfind(c, pos), ref.rfind(c, pos));
+        BOOST_TEST_EQ(s.find(c, pos), ref.find(c, pos));
+        BOOST_TEST_EQ(s.find_last_of(c, pos), ref.find_last_of(c, pos));
+        BOOST_TEST_EQ(s.find_last_not_of(c, pos), ref.find_last_not_of(c, pos));
+      }
+      BOOST_TEST_EQ(s.find_last_of(c), ref.find_last_of(c));
+      BOOST_TEST_EQ(s.find_last_not_of(c), ref.find_last_not_of(c));
+    }
+  }
+  // matches at the very beginning of the string
+  S s(1, CharT('b'));
+  s.append(299, CharT('a'));
+  const CharT ba[] = {'b', 'a', 'a', 0};
+  BOOST_TEST_EQ(s.rfind(ba, S::npos, 2), 0u);
+  BOOST_TEST_EQ(s.rfind(ba, S::npos, 3), 0u);
+  BOOST_TEST_EQ(s.rfind(CharT('b')), 0u);
+  BOOST_TEST_EQ(s.find_last_not_of(CharT('a')), 0u);
+  BOOST_TEST(s.find_last_not_of(CharT('a'), 0) == 0u);
+  BOOST_TEST(s.rfind(ba + 1, S::npos, 2) == 298u);
+  BOOST_TEST(s.rfind(CharT('c')) == S::npos);
+}
+
+void
+testRFindLong()
+{
+  testRFindLongImpl<char>();
+  testRFindLongImpl<char16_t>();
+  testRFindLongImpl<char32_t>();
+}
+
+void
+testFindOfLong()
+{
+  using S = static_string<300>;
+  // bytes from all over the range, including negative chars
+  std::string hay;
+  unsigned state = 7;
+  for (std::size_t i = 0; i < 300; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    const unsigned r = (state >> 16) % 64;
+    hay.push_back(r < 32 ? "ab ,.\t\n;"[r % 8] : char(r * 37 + 11));
+  }
+  std::string all;
+  for (int c = 0; c < 256; c += 3)
+    all.push_back(char(c));
+  const std::string sets[] = {
+    " \t\n", " ,.;", "ab", "\x80\xff", "\xde\xad\xbe\xef",
+    std::string("\0x", 2), "abcdefghijklmnopqrstuvwxyz",
+    " !1AQaq\x81\x91\xa1\xb1\xc1", all, "z"};
+  for (std::size_t len = 0; len <= hay.size(); len += 13)
+  {
+    const S s(hay.data(), len);
+    const std::string ref(hay.data(), len);
+    for (const auto& set : sets)
+    {
+      for (std::size_t pos = 0; pos <= len; pos += 17)
+      {
+        BOOST_TEST_EQ(s.find_first_of(set.data(), pos, set.size()),
+          ref.find_first_of(set, pos));
+        BOOST_TEST_EQ(s.find_first_not_of(set.data(), pos, set.size()),
+          ref.find_first_not_of(set, pos));
+        BOOST_TEST_EQ(s.find_last_of(set.data(), pos, set.size()),
+          ref.find_last_of(set, pos));
+        BOOST_TEST_EQ(s.find_last_not_of(set.data(), pos, set.size()),
+          ref.find_last_not_of(set, pos));
+      }
+      BOOST_TEST_EQ(s.find_last_of(set.data(), S::npos, set.size()),
+        ref.find_last_of(set));
+      BOOST_TEST_EQ(s.find_last_not_of(set.data(), S::npos, set.size()),
+        ref.find_last_not_of(set));
+    }
+  }
+  // members only at the ends
+  S s(300, 'x');
+  s.front() = ' ';
+  s.back() = '\t';
+  BOOST_TEST_EQ(s.find_first_of(" \t"), 0u);
+  BOOST_TEST_EQ(s.find_first_of(" \t", 1), 299u);
+  BOOST_TEST_EQ(s.find_last_of(" \t", 298), 0u);
+  BOOST_TEST_EQ(s.find_first_not_of("xy", 1), 299u);
+  BOOST_TEST_EQ(s.find_last_not_of("xy", 298), 0u);
+  BOOST_TEST(s.find_first_not_of(" \tx") == S::npos);
+  BOOST_TEST(s.find_last_not_of(" \tx") == S::npos);
+}
+
+void
+testSearcher()
+{
+  using S = static_string<300>;
+  // a small alphabet produces many partial matches,
+  // and a periodic string many overlapping ones
+  std::string hays[2];
+  unsigned state = 3;
+  for (std::size_t i = 0; i < 300; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    hays[0].push_back("ab"[(state >> 16) % 2]);
+    hays[1].push_back(i % 7 == 6 ? 'b' : 'a');
+  }
+  for (const auto& hay : hays)
+  {
+    const S s(hay.data(), hay.size());
+    for (std::size_t n = 1; n <= 100; n += 3)
+    {
+      for (std::size_t start = 0; start + n <= hay.size(); start += 41)
+      {
+        std::string needle = hay.substr(start, n);
+        for (int twice = 0; twice < 2; ++twice)
+        {
+          const static_string_searcher<char> searcher(needle.data(), n);
+          for (std::size_t pos = 0; pos <= hay.size(); pos += 23)
+            BOOST_TEST_EQ(s.find(searcher, pos), hay.find(needle, pos));
+          // a needle which is not found
+          needle.back() = needle.back() == 'a' ? 'b' : 'a';
+        }
+      }
+    }
+  }
+  {
+    const std::string needle = std::string(40, 'a') + 'b';
+    const static_string_searcher<char> searcher(needle.c_str());
+    S s(100, 'a');
+    BOOST_TEST(s.find(searcher) == S::npos);
+    s.back() = 'b';
+    BOOST_TEST_EQ(s.find(searcher), 59u);
+    BOOST_TEST(s.find(searcher, 60) == S::npos);
+    const auto res = searcher(s.data(), s.data() + s.size());
+    BOOST_TEST(res.first == s.data() + 59);
+    BOOST_TEST(res.second == s.data() + 100);
+  }
+  {
+    const static_string_searcher<char> searcher("", 0);
+    const S s = "abc";
+    BOOST_TEST_EQ(s.find(searcher), 0u);
+    BOOST_TEST_EQ(s.find(searcher, 3), 3u);
+    BOOST_TEST(s.find(searcher, 4) == S::npos);
+  }
+  {
+    const std::u16string needle(50, u'x');
+    const static_string_searcher<char16_t> searcher(needle.data(), needle.size());
+    static_u16string<100> s(30, u'y');
+    s.append(60, u'x');
+    BOOST_TEST_EQ(s.find(searcher), 30u);
+    BOOST_TEST_EQ(s.find(searcher, 40), 40u);
+    BOOST_TEST(s.find(searcher, 41) == S::npos);
+  }
+  // char_traits<char>::compare is constexpr in C++17
+#ifdef BOOST_STATIC_STRING_CPP17
+  {
+    constexpr static_string_searcher<char> searcher("needle", 6);
+    const static_string<30> s = "haystack with a needle";
+    BOOST_TEST_EQ(s.find(searcher), 16u);
+  }
+#endif
+}
+
 #include <iostream>
 
 #if defined(__GNUC__) && __GNUC__ >= 8
@@ -7346,6 +8109,85 @@ testHash()
   BOOST_TEST(hasher(U("1234567890")) == hasher(U("1234567890")));
 }
 
+void
+testFastHash()
+{
+  fast_hash hasher;
+  // every prefix of a string hashes differently,
+  // and the capacity does not matter
+  const static_string<100> s =
+    "The quick brown fox jumps over the lazy dog, "
+    "then the fox naps under the old oak tree.";
+  std::size_t hashes[101];
+  for (std::size_t n = 0; n <= s.size(); ++n)
+  {
+    hashes[n] = hasher(s.substr(0, n));
+    BOOST_TEST_EQ(hashes[n], hasher(static_string<200>(s.data(), n)));
+    for (std::size_t i = 0; i < n; ++i)
+      BOOST_TEST_NE(hashes[i], hashes[n]);
+  }
+  // changing any single character changes the hash
+  for (std::size_t i = 0; i < s.size(); ++i)
+  {
+    auto t = s;
+    t[i] = '#';
+    BOOST_TEST_NE(hasher(t), hashes[s.size()]);
+  }
+  BOOST_TEST_NE(hasher(static_u16string<4>(u"ab")), hasher(static_u16string<4>(u"ba")));
+  BOOST_TEST_EQ(hasher(static_u32string<4>(U"ab")), hasher(static_u32string<8>(U"ab")));
+}
+
+void
+testTransparent()
+{
+  using S = static_string<64>;
+  const static_string_hash hasher;
+  const static_string_equal eq;
+  const static_string_less less;
+  const S s = "key";
+  const string_like sl("key", 3);
+  const std::string str = "key";
+  const char* cs = "key";
+
+  // all representations hash the same as std::hash
+  const std::size_t h = std::hash<S>()(s);
+  BOOST_TEST_EQ(hasher(s), h);
+  BOOST_TEST_EQ(hasher(static_string<3>("key")), h);
+  BOOST_TEST_EQ(hasher(sl), h);
+  BOOST_TEST_EQ(hasher(str), h);
+  BOOST_TEST_EQ(hasher(cs), h);
+  BOOST_TEST_EQ(hasher("key"), h);
+  BOOST_TEST_NE(hasher("kez"), h);
+
+  BOOST_TEST(eq(s, sl));
+  BOOST_TEST(eq(sl, s));
+  BOOST_TEST(eq(s, cs));
+  BOOST_TEST(eq("key", s));
+  BOOST_TEST(eq(s, static_string<3>("key")));
+  BOOST_TEST(!eq(s, "keys"));
+  BOOST_TEST(!eq(str, "ke"));
+
+  BOOST_TEST(less(s, "kez"));
+  BOOST_TEST(!less(s, "key"));
+  BOOST_TEST(less("ke", s));
+  BOOST_TEST(less(sl, S("keys")));
+  BOOST_TEST(!less(S("keys"), str));
+
+#ifdef BOOST_STATIC_STRING_CPP14
+  std::map<S, int, static_string_less> m;
+  m.emplace("alpha", 1);
+  m.emplace("key", 2);
+  BOOST_TEST(m.find(cs) != m.end());
+  BOOST_TEST_EQ(m.find(sl)->second, 2);
+  BOOST_TEST(m.find("beta") == m.end());
+#endif
+
+  const basic_static_string_hash<char16_t> hasher16;
+  const basic_static_string_equal<char16_t> eq16;
+  BOOST_TEST_EQ(hasher16(static_u16string<8>(u"key")), hasher16(u"key"));
+  BOOST_TEST(eq16(u"key", static_u16string<8>(u"key")));
+}
+
 void
 testEmpty()
 {
@@ -7355,6 +8197,30 @@ testEmpty()
   BOOST_TEST(a.capacity() == 0);
 }
 
+void
+testUninitialized()
+{
+  static_string<4096> a(uninitialized);
+  BOOST_TEST(a.empty());
+  BOOST_TEST(a.size() == 0);
+  BOOST_TEST(*a.c_str() == 0);
+  a = "hello";
+  BOOST_TEST(a == "hello");
+  BOOST_TEST(*a.end() == 0);
+  a.append(4091, 'a');
+  BOOST_TEST(a.size() == 4096);
+  BOOST_TEST(*a.end() == 0);
+
+  static_string<0> b(uninitialized);
+  BOOST_TEST(b.empty());
+  BOOST_TEST(*b.c_str() == 0);
+
+  static_u16string<8> c(uninitialized);
+  BOOST_TEST(c.empty());
+  c.push_back(u'a');
+  BOOST_TEST(c == u"a");
+}
+
 void
 testResize()
 {
@@ -7366,6 +8232,56 @@ testResize()
   b.resize(b.size() + 1, 'a');
   BOOST_TEST(b == "aa");
   BOOST_TEST(b.size() == 2);
+
+  // resize_and_overwrite
+  {
+    static_string<10> s = "abc";
+    s.resize_and_overwrite(8, [](char* p, std::size_t n) -> std::size_t
+    {
+      BOOST_TEST(n == 8);
+      BOOST_TEST(std::memcmp(p, "abc", 3) == 0);
+      std::memcpy(p + 3, "defgh", 5);
+      return n;
+    });
+    BOOST_TEST(s == "abcdefgh");
+    BOOST_TEST(*s.end() == 0);
+
+    s.resize_and_overwrite(s.max_size(), [](char* p, std::size_t)
+    {
+      return std::snprintf(p, 11, "%d", 12345);
+    });
+    BOOST_TEST(s == "12345");
+
+    s.resize_and_overwrite(2, [](char*, std::size_t n) { return n; });
+    BOOST_TEST(s == "12");
+    s.resize_and_overwrite(10, [](char*, std::size_t) { return 0; });
+    BOOST_TEST(s.empty());
+    BOOST_TEST(*s.end() == 0);
+
+    BOOST_TEST_THROWS(s.resize_and_overwrite(11,
+      [](char*, std::size_t n) { return n; }), std::length_error);
+
+    static_string<0> e;
+    e.resize_and_overwrite(0, [](char* p, std::size_t n)
+    {
+      p[0] = 'x';
+      return n;
+    });
+    BOOST_TEST(e.empty());
+    BOOST_TEST(*e.end() == 0);
+    BOOST_TEST_THROWS(e.resize_and_overwrite(1,
+      [](char*, std::size_t n) { return n; }), std::length_error);
+
+    basic_static_string<4, char, std::char_traits<char>,
+      truncate_on_overflow> t;
+    t.resize_and_overwrite(16, [](char* p, std::size_t n) -> std::size_t
+    {
+      BOOST_TEST(n == 4);
+      std::memset(p, 'x', n);
+      return n;
+    });
+    BOOST_TEST(t == "xxxx");
+  }
 }
 
 void
@@ -7381,6 +8297,403 @@ testStream()
   BOOST_TEST(b == c);
 }
 
+// A stream buffer which makes only a few characters
+// available at a time, or one when unbuffered
+class chunked_streambuf
+  : public std::streambuf
+{
+  std::string s_;
+  std::size_t pos_ = 0;
+  std::size_t chunk_;
+
+public:
+  chunked_streambuf(std::string s, std::size_t chunk)
+    : s_(std::move(s)), chunk_(chunk)
+  {
+  }
+
+protected:
+  int_type
+  underflow() override
+  {
+    if (gptr() != egptr())
+      return traits_type::to_int_type(*gptr());
+    if (pos_ == s_.size())
+      return traits_type::eof();
+    if (!chunk_)
+      return traits_type::to_int_type(s_[pos_]);
+    char* first = &s_[pos_];
+    pos_ += (std::min)(chunk_, s_.size() - pos_);
+    setg(first, first, &s_[0] + pos_);
+    return traits_type::to_int_type(*first);
+  }
+
+  int_type
+  uflow() override
+  {
+    if (chunk_)
+      return std::streambuf::uflow();
+    if (pos_ == s_.size())
+      return traits_type::eof();
+    return traits_type::to_int_type(s_[pos_++]);
+  }
+};
+
+// A stream buffer which throws once its characters are used
+struct throwing_streambuf : std::streambuf
+{
+  char buf_[2] = {'a', 'b'};
+
+  throwing_streambuf()
+  {
+    setg(buf_, buf_, buf_ + 2);
+  }
+
+  int_type
+  underflow() override
+  {
+    throw std::runtime_error("underflow");
+  }
+};
+
+void
+testStreamInput()
+{
+  // operator>>
+  {
+    std::istringstream is("  hello \t world\nx");
+    static_string<8> s;
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "hello");
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "world");
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "x");
+    BOOST_TEST(is.eof());
+    BOOST_TEST(!(is >> s));
+    BOOST_TEST(s == "x");
+  }
+  {
+    // a word longer than the capacity fails
+    std::istringstream is("abcdefgh abcdefghi");
+    static_string<8> s;
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "abcdefgh");
+    BOOST_TEST(!(is >> s));
+    BOOST_TEST(s == "abcdefgh");
+    is.clear();
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "i");
+  }
+  {
+    std::istringstream is("abcdefgh");
+    static_string<8> s;
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "abcdefgh");
+    BOOST_TEST(is.eof());
+  }
+  {
+    // the width limits the characters extracted
+    std::istringstream is("abcdefghijklmn");
+    static_string<8> s;
+    is.width(3);
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == "abc");
+    BOOST_TEST(is.width() == 0);
+    is.width(20);
+    BOOST_TEST(!(is >> s));
+    BOOST_TEST(s == "defghijk");
+  }
+  {
+    std::istringstream is("a b");
+    static_string<0> s;
+    BOOST_TEST(!(is >> s));
+  }
+
+  // getline
+  {
+    std::istringstream is("first line\n\nthird;x\nlast");
+    static_string<16> s;
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s == "first line");
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s.empty());
+    BOOST_TEST(getline(is, s, ';'));
+    BOOST_TEST(s == "third");
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s == "x");
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s == "last");
+    BOOST_TEST(is.eof() && !is.fail());
+    BOOST_TEST(!getline(is, s));
+    BOOST_TEST(s == "last");
+  }
+  {
+    // a line longer than the capacity fails and
+    // leaves the rest of the line in the stream
+    std::istringstream is("abcd\nabcde\n");
+    static_string<4> s;
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s == "abcd");
+    BOOST_TEST(!getline(is, s));
+    BOOST_TEST(s == "abcd");
+    is.clear();
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s == "e");
+    BOOST_TEST(!getline(is, s));
+    BOOST_TEST(is.eof());
+  }
+  {
+    std::istringstream is("\n");
+    static_string<0> s;
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(!getline(is, s));
+  }
+  {
+    // lines spanning many refills of the buffer
+    std::string text;
+    for (int i = 0; i < 200; ++i)
+      text.append(std::to_string(i * 7919 % 100003)).append(i % 3 ? " " : "\n");
+    for (std::size_t chunk : {0, 1, 3, 7, 64})
+    {
+      {
+        chunked_streambuf sb(text, chunk);
+        std::istream is(&sb);
+        std::istringstream expected(text);
+        static_string<512> s;
+        std::string line;
+        while (std::getline(expected, line))
+        {
+          BOOST_TEST(getline(is, s));
+          BOOST_TEST(s == line.c_str());
+        }
+        BOOST_TEST(!getline(is, s));
+      }
+      {
+        chunked_streambuf sb(text, chunk);
+        std::istream is(&sb);
+        std::istringstream expected(text);
+        static_string<8> s;
+        std::string word;
+        while (expected >> word)
+        {
+          BOOST_TEST(is >> s);
+          BOOST_TEST(s == word.c_str());
+        }
+        BOOST_TEST(!(is >> s));
+      }
+      {
+        chunked_streambuf sb("abcdefghij\nk", chunk);
+        std::istream is(&sb);
+        static_string<5> s;
+        BOOST_TEST(!getline(is, s));
+        BOOST_TEST(s == "abcde");
+        is.clear();
+        BOOST_TEST(getline(is, s));
+        BOOST_TEST(s == "fghij");
+        BOOST_TEST(getline(is, s));
+        BOOST_TEST(s == "k");
+      }
+    }
+  }
+  {
+    std::wistringstream is(L"wide words\nline two");
+    static_wstring<8> s;
+    BOOST_TEST(is >> s);
+    BOOST_TEST(s == L"wide");
+    BOOST_TEST(getline(is, s));
+    BOOST_TEST(s == L" words");
+    BOOST_TEST(getline(is, s, L' '));
+    BOOST_TEST(s == L"line");
+  }
+  // an exception from the stream buffer sets badbit,
+  // and is rethrown only if badbit is in exceptions()
+  {
+    throwing_streambuf sb;
+    std::istream is(&sb);
+    static_string<8> s;
+    BOOST_TEST(!(is >> s));
+    BOOST_TEST(is.bad());
+    BOOST_TEST(s == "ab");
+  }
+  {
+    throwing_streambuf sb;
+    std::istream is(&sb);
+    static_string<8> s;
+    BOOST_TEST(!getline(is, s));
+    BOOST_TEST(is.bad());
+  }
+  {
+    throwing_streambuf sb;
+    std::istream is(&sb);
+    is.exceptions(std::ios_base::badbit);
+    static_string<8> s;
+    BOOST_TEST_THROWS(is >> s, std::runtime_error);
+    BOOST_TEST(is.bad());
+    BOOST_TEST(is.exceptions() == std::ios_base::badbit);
+  }
+  {
+    throwing_streambuf sb;
+    std::istream is(&sb);
+    is.exceptions(std::ios_base::badbit);
+    static_string<8> s;
+    BOOST_TEST_THROWS(getline(is, s), std::runtime_error);
+    BOOST_TEST(is.bad());
+  }
+}
+
+void
+testOutputStream()
+{
+  // basic_static_ostringstream
+  {
+    static_ostringstream<32> os;
+    os << "id=" << 42 << ' ' << 1.5 << static_string<4>("!");
+    BOOST_TEST(os);
+    BOOST_TEST(os.str() == "id=42 1.5!");
+    BOOST_TEST(os.str().size() == 10);
+    BOOST_TEST(*os.str().end() == '\0');
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    BOOST_TEST(os.view() == "id=42 1.5!");
+#endif
+    os << std::hex << 255;
+    BOOST_TEST(os.str() == "id=42 1.5!ff");
+    os.str("x");
+    os << 'y';
+    BOOST_TEST(os.str() == "xy");
+    BOOST_TEST(!os.rdbuf()->truncates());
+  }
+  {
+    // output which does not fit sets badbit
+    static_ostringstream<8> os;
+    os << "12345";
+    BOOST_TEST(os);
+    os << "6789";
+    BOOST_TEST(os.bad());
+    BOOST_TEST(os.str() == "12345678");
+  }
+  {
+    // or is discarded
+    static_ostringstream<8> os(true);
+    os << "12345" << 6789 << 'x';
+    BOOST_TEST(os);
+    BOOST_TEST(os.str() == "12345678");
+    BOOST_TEST(os.rdbuf()->truncated());
+    os.str("");
+    BOOST_TEST(!os.rdbuf()->truncated());
+    os << std::setw(4) << 7;
+    BOOST_TEST(os.str() == "   7");
+  }
+  {
+    static_ostringstream<0> os;
+    os << "";
+    BOOST_TEST(os);
+    os << 'a';
+    BOOST_TEST(os.bad());
+    BOOST_TEST(os.str().empty());
+  }
+  {
+    static_ostringstream<16> os(static_string<16>("log: "));
+    os << 1 << '/' << 2;
+    BOOST_TEST(os.str() == "log: 1/2");
+  }
+
+  // basic_static_stringbuf
+  {
+    static_stringbuf<16> buf;
+    std::ostream os(&buf);
+    os << "abc" << 123;
+    BOOST_TEST(buf.str() == "abc123");
+    buf.clear();
+    BOOST_TEST(buf.str().empty());
+    os << std::string(20, 'z');
+    BOOST_TEST(os.bad());
+    BOOST_TEST(buf.str() == std::string(16, 'z').c_str());
+    BOOST_TEST(!buf.truncated());
+  }
+  {
+    // a const buffer returns a copy and is not modified
+    static_stringbuf<16> buf;
+    std::ostream os(&buf);
+    os << "abc";
+    const static_stringbuf<16>& cbuf = buf;
+    BOOST_TEST(cbuf.str() == "abc");
+    os << "de";
+    BOOST_TEST(cbuf.str() == "abcde");
+    BOOST_TEST(*cbuf.str().end() == '\0');
+  }
+  {
+    // the put position can be queried and moved
+    static_ostringstream<16> os;
+    BOOST_TEST(os.tellp() == 0);
+    os << "hello world";
+    BOOST_TEST(os.tellp() == 11);
+    os.seekp(6);
+    BOOST_TEST(os.tellp() == 6);
+    os << "there";
+    BOOST_TEST(os.str() == "hello there");
+    os.seekp(0);
+    os << "J";
+    BOOST_TEST(os.str() == "Jello there");
+    BOOST_TEST(os.tellp() == 1);
+    os.seekp(-2, std::ios_base::end);
+    os << "R";
+    BOOST_TEST(os.str() == "Jello theRe");
+    os.seekp(0, std::ios_base::end);
+    os << '!';
+    BOOST_TEST(os.str() == "Jello theRe!");
+    BOOST_TEST(os);
+    os.seekp(13);
+    BOOST_TEST(os.fail());
+    os.clear();
+    BOOST_TEST(os.tellp() == 12);
+    os.seekp(-1, std::ios_base::beg);
+    BOOST_TEST(os.fail());
+  }
+  {
+    static_wostringstream<16> os;
+    os << L"w=" << 3.25;
+    BOOST_TEST(os.str() == L"w=3.25");
+  }
+}
+
+void
+testFormat()
+{
+#ifdef BOOST_STATIC_STRING_HAS_FORMAT
+  // static_format<N>(fmt, args...)
+  BOOST_TEST(static_format<16>("{}:{}", "host", 8080) == "host:8080");
+  BOOST_TEST(static_format<16>("{:>6}|{:<4}|", 42, 'x') == "    42|x   |");
+  BOOST_TEST(static_format<16>("{:.3f}", 3.14159) == "3.142");
+  BOOST_TEST(static_format<16>("{:#x}", 255u) == "0xff");
+  BOOST_TEST(static_format<16>("").empty());
+  BOOST_TEST(static_format<4>("{}", 1234) == "1234");
+  BOOST_TEST_THROWS(static_format<4>("{}", 12345), std::length_error);
+  BOOST_TEST_THROWS(static_format<0>("x"), std::length_error);
+  {
+    static_string<64> s = static_format<64>("{:*^64}", "");
+    BOOST_TEST(s.size() == 64);
+    BOOST_TEST(s.find_first_not_of('*') == s.npos);
+    BOOST_TEST(*s.end() == '\0');
+  }
+
+  // std::formatter<basic_static_string>
+  static_string<8> hello = "hello";
+  BOOST_TEST(std::format("[{}]", hello) == "[hello]");
+  BOOST_TEST(std::format("[{:>7}]", hello) == "[  hello]");
+  BOOST_TEST(std::format("[{:.2}]", hello) == "[he]");
+  BOOST_TEST(static_format<16>("{}, {}!", hello, static_string<5>("world")) ==
+    "hello, world!");
+  BOOST_TEST(std::format("{}", static_string<0>()).empty());
+
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+  BOOST_TEST(static_format<16>(L"{}-{}", 1, L"a") == L"1-a");
+  BOOST_TEST(std::format(L"[{:<6}]", static_wstring<4>(L"ab")) == L"[ab    ]");
+  BOOST_TEST_THROWS(static_format<2>(L"{}", 100), std::length_error);
+#endif
+#endif
+}
+
 void
 testOperatorPlus()
 {
@@ -7446,6 +8759,709 @@ testOperatorPlus()
   }
 }
 
+void
+testConcat()
+{
+  static_string<10> s1 = "hello";
+  static_string<10> s2 = "world";
+
+  // concat(pieces...)
+  {
+    auto res = concat(s1, ", ", s2, '!');
+    BOOST_TEST(res == "hello, world!");
+    BOOST_TEST(res.capacity() == 23);
+    BOOST_TEST(res.size() == 13);
+    BOOST_TEST(*res.end() == '\0');
+  }
+  {
+    auto res = concat("ab", 'c', "");
+    BOOST_TEST(res == "abc");
+    BOOST_TEST(res.capacity() == 3);
+  }
+  {
+    auto res = concat(static_string<0>());
+    BOOST_TEST(res.empty());
+    BOOST_TEST(res.capacity() == 0);
+  }
+  {
+    // an array which is not null-terminated
+    const char arr[3] = {'x', 'y', 'z'};
+    auto res = concat(arr, s1);
+    BOOST_TEST(res == "xyhello");
+    const char full[3] = {'a', 'b', '\0'};
+    BOOST_TEST(concat(full, full) == "abab");
+  }
+  {
+    // the character type and traits come from the
+    // first string or array
+    auto res = concat(L'<', static_wstring<4>(L"ab"), L">");
+    BOOST_TEST(res == L"<ab>");
+    BOOST_TEST(res.capacity() == 6);
+  }
+
+  // concat<N>(pieces...)
+  {
+    static_string<16> res = concat<16>(s1, ' ', s2);
+    BOOST_TEST(res == "hello world");
+    const char* p = "ptr";
+    BOOST_TEST(concat<16>(s1, p) == "helloptr");
+    BOOST_TEST(concat<16>(s1, std::string("std"), '.') == "hellostd.");
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    BOOST_TEST(concat<16>(s1, s2.subview(1, 3)) == "helloorl");
+#endif
+    BOOST_TEST(concat<11>(s1, s2, '!') == "helloworld!");
+    BOOST_TEST_THROWS(concat<10>(s1, s2, '!'), std::length_error);
+    BOOST_TEST_THROWS(concat<0>("a"), std::length_error);
+    BOOST_TEST(concat<0>(s1.substr(0, 0), "").empty());
+  }
+  {
+    // consecutive characters each refer to their own argument
+    BOOST_TEST(concat<16>(static_string<4>("ab"), 'A', 'c', 'z') == "abAcz");
+    const char c = 'q';
+    BOOST_TEST(concat<4>(c, c, "!") == "qq!");
+    // only characters of exactly the character type are
+    // pieces, other scalars do not compile (see compile_fail.hpp)
+  }
+}
+
+void
+testSplitJoin()
+{
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+  using sv = static_string<0>::string_view_type;
+
+  // split(str, CharT)
+  {
+    static_string<32> s = "id,name,,price";
+    std::vector<std::string> fields;
+    for (sv field : split(s, ','))
+      fields.emplace_back(field.data(), field.size());
+    BOOST_TEST(fields.size() == 4);
+    BOOST_TEST(fields[0] == "id");
+    BOOST_TEST(fields[1] == "name");
+    BOOST_TEST(fields[2].empty());
+    BOOST_TEST(fields[3] == "price");
+
+    // the fields refer to the source string
+    auto view = split(s, ',');
+    auto it = view.begin();
+    BOOST_TEST(it->data() == s.data());
+    BOOST_TEST((++it)->data() == s.data() + 3);
+    BOOST_TEST(it++ != view.end());
+    BOOST_TEST(it->empty());
+    ++it;
+    BOOST_TEST(*it == "price");
+    BOOST_TEST(++it == view.end());
+  }
+  {
+    auto count = [](const static_string<64>& s, char c)
+    {
+      std::size_t n = 0;
+      for (auto it = split(s, c).begin(); it != decltype(it)(); ++it)
+        ++n;
+      return n;
+    };
+    BOOST_TEST(count("", ',') == 1);
+    BOOST_TEST(count(",", ',') == 2);
+    BOOST_TEST(count("abc", ',') == 1);
+    BOOST_TEST(count(",a,", ',') == 3);
+    BOOST_TEST(count(std::string(63, ';').c_str(), ';') == 64);
+  }
+  {
+    // delimiters found by the vectorized search
+    static_string<512> s;
+    for (int i = 0; i < 40; ++i)
+      s.append(std::to_string(i * 7919 % 10007).c_str()).push_back('|');
+    std::size_t n = 0;
+    for (sv field : split(s, '|'))
+    {
+      if (n < 40)
+        BOOST_TEST(field == std::to_string(n * 7919 % 10007).c_str());
+      else
+        BOOST_TEST(field.empty());
+      ++n;
+    }
+    BOOST_TEST(n == 41);
+  }
+
+  // split(str, string)
+  {
+    static_string<32> s = "a::b:c::::d";
+    std::vector<std::string> fields;
+    for (sv field : split(s, "::"))
+      fields.emplace_back(field.data(), field.size());
+    BOOST_TEST(fields.size() == 4);
+    BOOST_TEST(fields[0] == "a");
+    BOOST_TEST(fields[1] == "b:c");
+    BOOST_TEST(fields[2].empty());
+    BOOST_TEST(fields[3] == "d");
+
+    static_string<4> delim = "::";
+    std::size_t n = 0;
+    for (sv field : split(s, delim.subview()))
+      n += field.size();
+    BOOST_TEST(n == 5);
+
+    n = 0;
+    static_string<1> x = "x";
+    for (sv field : split(x, "long delimiter"))
+      n += field == "x";
+    BOOST_TEST(n == 1);
+  }
+
+  // join<N>(range, sep)
+  {
+    static_string<32> s = "id,name,,price";
+    BOOST_TEST(join<32>(split(s, ','), ',') == s);
+    BOOST_TEST(join<32>(split(s, ','), "; ") == "id; name; ; price");
+    BOOST_TEST(join<32>(split(s, ','), sv("")) == "idnameprice");
+    BOOST_TEST_THROWS(join<13>(split(s, ','), ','), std::length_error);
+    BOOST_TEST(join<14>(split(s, ','), ',').size() == 14);
+
+    std::vector<static_string<8>> words = {"a", "bc", "def"};
+    BOOST_TEST(join<16>(words, '-') == "a-bc-def");
+    const std::vector<char> letters = {'x', 'y', 'z'};
+    BOOST_TEST(join<8>(letters, ", ") == "x, y, z");
+    BOOST_TEST(join<16>(std::vector<std::string>(), '-').empty());
+    const char* ptrs[] = {"x", "y"};
+    BOOST_TEST(join<8>(ptrs, " + ") == "x + y");
+    BOOST_TEST(join<0>(std::vector<std::string>(1), ',').empty());
+    BOOST_TEST_THROWS(join<0>(std::vector<std::string>(2), ','), std::length_error);
+  }
+  {
+    static_wstring<16> ws = L"a b  c";
+    BOOST_TEST(join<16>(split(ws, L' '), L"_") == L"a_b__c");
+  }
+#endif
+}
+
+// Returns one of two named strings, so that the
+// copy into the return value cannot be elided.
+basic_static_string<8, char, std::char_traits<char>,
+  saturate_on_overflow>
+pick_saturated(
+  bool first,
+  const basic_static_string<8, char, std::char_traits<char>,
+    saturate_on_overflow>& s)
+{
+  basic_static_string<8, char, std::char_traits<char>,
+    saturate_on_overflow> a = s;
+  basic_static_string<8, char, std::char_traits<char>,
+    saturate_on_overflow> b;
+  return first ? a : b;
+}
+
+void
+testOverflowPolicy()
+{
+  using trunc_string = basic_static_string<
+    8, char, std::char_traits<char>, truncate_on_overflow>;
+  using sat_string = basic_static_string<
+    8, char, std::char_traits<char>, saturate_on_overflow>;
+  using fast_string = basic_static_string<
+    8, char, std::char_traits<char>, assert_on_overflow>;
+
+  BOOST_TEST(sizeof(trunc_string) == sizeof(static_string<8>));
+  BOOST_TEST(sizeof(fast_string) == sizeof(static_string<8>));
+
+  // throw_on_overflow is the default
+  {
+    static_string<3> s = "abc";
+    BOOST_TEST_THROWS(s.push_back('d'), std::length_error);
+    BOOST_TEST_THROWS(s.append(2, 'x'), std::length_error);
+    BOOST_TEST_THROWS(s.replace(0, 1, "xy"), std::length_error);
+    BOOST_TEST(s == "abc");
+    // a replacement which exactly fills the string
+    s.replace(0, 1, "x");
+    BOOST_TEST(s == "xbc");
+    s.replace(s.begin(), s.begin() + 2, 2, 'y');
+    BOOST_TEST(s == "yyc");
+  }
+
+  // truncate_on_overflow
+  {
+    trunc_string s = "truncated output";
+    BOOST_TEST(s == "truncate");
+    s.assign(20, 'x');
+    BOOST_TEST(s == "xxxxxxxx");
+    s = "abc";
+    s.append("defghijk");
+    BOOST_TEST(s == "abcdefgh");
+    s.push_back('i');
+    BOOST_TEST(s == "abcdefgh");
+    BOOST_TEST(*s.end() == 0);
+
+    s = "abcdef";
+    s.insert(1, "12345");
+    BOOST_TEST(s == "a12bcdef");
+    s = "abcdef";
+    s.insert(s.begin() + 1, 5, '*');
+    BOOST_TEST(s == "a**bcdef");
+    s = "abcdef";
+    s.replace(1, 1, "wxyz");
+    BOOST_TEST(s == "awxycdef");
+    s = "abc";
+    s += static_string<8>("defghijk");
+    BOOST_TEST(s == "abcdefgh");
+    s = "ab";
+    s.resize(12, '.');
+    BOOST_TEST(s == "ab......");
+
+    std::string src = "0123456789";
+    s = "ab";
+    s.append(src.begin(), src.end());
+    BOOST_TEST(s == "ab012345");
+    s = "ab";
+    s.insert(s.begin(), src.begin(), src.end());
+    BOOST_TEST(s == "012345ab");
+
+    std::istringstream in("qrstuvwxyz");
+    s = "ab";
+    s.append(std::istreambuf_iterator<char>(in),
+      std::istreambuf_iterator<char>());
+    BOOST_TEST(s == "abqrstuv");
+    BOOST_TEST(*s.end() == 0);
+    in.clear();
+    in.str("qrstuvwxyz");
+    s = "ab";
+    s.insert(s.begin() + 1, std::istreambuf_iterator<char>(in),
+      std::istreambuf_iterator<char>());
+    BOOST_TEST(s == "aqrstuvb");
+    in.clear();
+    in.str("qrstuvwxyz");
+    s.assign(std::istreambuf_iterator<char>(in),
+      std::istreambuf_iterator<char>());
+    BOOST_TEST(s == "qrstuvwx");
+
+    // numbers are appended whole or not at all
+    s = "n=";
+    s.append_number(123456);
+    BOOST_TEST(s == "n=123456");
+    s = "n=";
+    s.append_number(1234567);
+    BOOST_TEST(s == "n=");
+
+    basic_static_string<4, char, std::char_traits<char>,
+      truncate_on_overflow> big = "abcd";
+    basic_static_string<2, char, std::char_traits<char>,
+      truncate_on_overflow> small = "xy";
+    swap(big, small);
+    BOOST_TEST(big == "xy");
+    BOOST_TEST(small == "ab");
+    BOOST_TEST(*small.end() == 0);
+    big = "1234";
+    swap(small, big);
+    BOOST_TEST(small == "12");
+    BOOST_TEST(big == "ab");
+    big = "z";
+    swap(big, small);
+    BOOST_TEST(big == "12");
+    BOOST_TEST(small == "z");
+
+    basic_static_string<0, char, std::char_traits<char>,
+      truncate_on_overflow> empty;
+    empty = 'a';
+    BOOST_TEST(empty.empty());
+  }
+
+  // saturate_on_overflow
+  {
+    sat_string s = "abc";
+    BOOST_TEST(!s.overflow_policy().overflowed());
+    s.append("def");
+    BOOST_TEST(!s.overflow_policy().overflowed());
+    s.append("ghi");
+    BOOST_TEST(s == "abcdefgh");
+    BOOST_TEST(s.overflow_policy().overflowed());
+    s.clear();
+    s.append("x");
+    BOOST_TEST(s.overflow_policy().overflowed());
+    s.overflow_policy().clear_overflow();
+    BOOST_TEST(!s.overflow_policy().overflowed());
+    s.push_back('y');
+    BOOST_TEST(s == "xy");
+    BOOST_TEST(!s.overflow_policy().overflowed());
+
+    basic_static_string<2, char, std::char_traits<char>,
+      saturate_on_overflow> small = "12";
+    s = "abcd";
+    s.swap(small);
+    BOOST_TEST(s == "12");
+    BOOST_TEST(small == "ab");
+    BOOST_TEST(small.overflow_policy().overflowed());
+    BOOST_TEST(!s.overflow_policy().overflowed());
+  }
+
+  // the flag is carried by copies, moves and assignments
+  {
+    sat_string s = "abcdef";
+    s.append("ghi");
+    BOOST_TEST(s.overflow_policy().overflowed());
+
+    sat_string copy = s;
+    BOOST_TEST(copy == "abcdefgh");
+    BOOST_TEST(copy.overflow_policy().overflowed());
+    sat_string moved = std::move(copy);
+    BOOST_TEST(moved.overflow_policy().overflowed());
+    BOOST_TEST(pick_saturated(true, s).overflow_policy().overflowed());
+    BOOST_TEST(!pick_saturated(false, s).overflow_policy().overflowed());
+
+    sat_string assigned = "x";
+    assigned = s;
+    BOOST_TEST(assigned == "abcdefgh");
+    BOOST_TEST(assigned.overflow_policy().overflowed());
+    assigned.overflow_policy().clear_overflow();
+    s = assigned;
+    BOOST_TEST(!s.overflow_policy().overflowed());
+    assigned = std::move(moved);
+    BOOST_TEST(assigned.overflow_policy().overflowed());
+  }
+
+  // assert_on_overflow
+  {
+    fast_string s = "abc";
+    s.append("defgh");
+    BOOST_TEST(s == "abcdefgh");
+    s.erase(2);
+    s.insert(std::size_t(0), 3, '-');
+    BOOST_TEST(s == "---ab");
+    s.replace(0, 3, "xyz12");
+    BOOST_TEST(s == "xyz12ab");
+    s.push_back('!');
+    BOOST_TEST(s.size() == s.max_size());
+    BOOST_TEST(*s.end() == 0);
+  }
+
+  // strings with different policies interoperate through views
+  {
+    trunc_string t = "abc";
+    fast_string f = "def";
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    BOOST_TEST(t.compare(f.subview()) < 0);
+    t.append(f.subview());
+#else
+    t.append(f.data(), f.size());
+#endif
+    BOOST_TEST(t == "abcdef");
+    BOOST_TEST(std::hash<trunc_string>()(t) ==
+      std::hash<static_string<8>>()(static_string<8>("abcdef")));
+  }
+
+  // comparisons and concatenation across policies
+  {
+    basic_static_string<4, char, std::char_traits<char>,
+      truncate_on_overflow> t = "abc";
+    static_string<8> s = "abd";
+    BOOST_TEST(!(t == s));
+    BOOST_TEST(t != s);
+    BOOST_TEST(t < s);
+    BOOST_TEST(t <= s);
+    BOOST_TEST(s > t);
+    BOOST_TEST(s >= t);
+    s = "abc";
+    BOOST_TEST(t == s);
+    BOOST_TEST(s == t);
+    BOOST_TEST(!(s < t));
+
+    auto ts = t + s;
+    static_assert(std::is_same<decltype(ts), basic_static_string<12, char,
+      std::char_traits<char>, truncate_on_overflow>>::value, "");
+    BOOST_TEST(ts == "abcabc");
+    auto st = s + t;
+    static_assert(std::is_same<decltype(st), static_string<12>>::value, "");
+    BOOST_TEST(st == "abcabc");
+  }
+}
+
+void
+testTryMutation()
+{
+  // try_push_back
+  {
+    static_string<2> s;
+    BOOST_TEST(s.try_push_back('a'));
+    BOOST_TEST(s.try_push_back('b'));
+    BOOST_TEST(!s.try_push_back('c'));
+    BOOST_TEST(s == "ab");
+    BOOST_TEST(*s.end() == 0);
+    static_string<0> e;
+    BOOST_TEST(!e.try_push_back('a'));
+  }
+
+  // try_append
+  {
+    static_string<6> s = "ab";
+    BOOST_TEST(s.try_append("cd"));
+    BOOST_TEST(!s.try_append("efg"));
+    BOOST_TEST(s == "abcd");
+    BOOST_TEST(s.try_append("efg", 2));
+    BOOST_TEST(s == "abcdef");
+    BOOST_TEST(!s.try_append(1, 'x'));
+    BOOST_TEST(s.try_append(0, 'x'));
+    s = "ab";
+    BOOST_TEST(s.try_append(4, '.'));
+    BOOST_TEST(s == "ab....");
+    s = "ab";
+    BOOST_TEST(s.try_append(s.data(), s.size()));
+    BOOST_TEST(s == "abab");
+    BOOST_TEST(*s.end() == 0);
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    BOOST_TEST(s.try_append(string_view("xy")));
+    BOOST_TEST(!s.try_append(string_view("z")));
+    BOOST_TEST(s == "ababxy");
+#endif
+    s = "ab";
+    static_string<4> f = "cd";
+    BOOST_TEST(s.try_append(f));
+    BOOST_TEST(s == "abcd");
+    BOOST_TEST(s.try_append(f, 1));
+    BOOST_TEST(s == "abcdd");
+    BOOST_TEST(!s.try_append(f, 0));
+    BOOST_TEST(!s.try_append(f, 3));
+    BOOST_TEST(s.try_append(s, 4, 1));
+    BOOST_TEST(s == "abcddd");
+    s = "abc";
+    BOOST_TEST(s.try_append(s));
+    BOOST_TEST(s == "abcabc");
+    BOOST_TEST(!s.try_append(s));
+    BOOST_TEST(*s.end() == 0);
+  }
+
+  // try_assign
+  {
+    static_string<4> s = "ab";
+    BOOST_TEST(!s.try_assign("abcde"));
+    BOOST_TEST(s == "ab");
+    BOOST_TEST(s.try_assign("wxyz"));
+    BOOST_TEST(s == "wxyz");
+    BOOST_TEST(s.try_assign(s.data() + 1, 2));
+    BOOST_TEST(s == "xy");
+    BOOST_TEST(!s.try_assign(5, 'a'));
+    BOOST_TEST(s.try_assign(3, 'a'));
+    BOOST_TEST(s == "aaa");
+    BOOST_TEST(*s.end() == 0);
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    BOOST_TEST(s.try_assign(string_view("1234")));
+    BOOST_TEST(!s.try_assign(string_view("12345")));
+    BOOST_TEST(s == "1234");
+#endif
+    BOOST_TEST(s.try_assign(static_string<2>("ab")));
+    BOOST_TEST(s == "ab");
+    BOOST_TEST(!s.try_assign(static_string<8>("abcde")));
+    BOOST_TEST(s.try_assign(static_string<8>("abcde"), 2));
+    BOOST_TEST(s == "cde");
+    BOOST_TEST(!s.try_assign(static_string<8>("abcde"), 6));
+    BOOST_TEST(s.try_assign(s, 1, 1));
+    BOOST_TEST(s == "d");
+    BOOST_TEST(s.try_assign(basic_static_string<4, char,
+      std::char_traits<char>, truncate_on_overflow>("xyz")));
+    BOOST_TEST(s == "xyz");
+  }
+
+  // try_insert
+  {
+    static_string<6> s = "abc";
+    BOOST_TEST(!s.try_insert(4, "x", 1));
+    BOOST_TEST(!s.try_insert(0, "wxyz", 4));
+    BOOST_TEST(s.try_insert(1, "xy", 2));
+    BOOST_TEST(s == "axybc");
+    BOOST_TEST(!s.try_insert(0, 2, '-'));
+    BOOST_TEST(s.try_insert(5, 1, '-'));
+    BOOST_TEST(s == "axybc-");
+    BOOST_TEST(*s.end() == 0);
+    s = "abc";
+    BOOST_TEST(s.try_insert(1, s.data(), 3));
+    BOOST_TEST(s == "aabcbc");
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    s = "abc";
+    BOOST_TEST(s.try_insert(3, string_view("def")));
+    BOOST_TEST(!s.try_insert(0, string_view("g")));
+    BOOST_TEST(s == "abcdef");
+#endif
+    s = "ad";
+    static_string<4> f = "bc";
+    BOOST_TEST(s.try_insert(1, f));
+    BOOST_TEST(s == "abcd");
+    BOOST_TEST(!s.try_insert(5, f));
+    BOOST_TEST(!s.try_insert(0, f, 3));
+    BOOST_TEST(s.try_insert(0, f, 1));
+    BOOST_TEST(s == "cabcd");
+    s = "abc";
+    BOOST_TEST(s.try_insert(1, s));
+    BOOST_TEST(s == "aabcbc");
+    BOOST_TEST(!s.try_insert(0, s, 5));
+    s = "abc";
+    BOOST_TEST(s.try_insert(3, s, 1, 2));
+    BOOST_TEST(s == "abcbc");
+    BOOST_TEST(*s.end() == 0);
+  }
+
+  // try_replace
+  {
+    static_string<6> s = "abcdef";
+    BOOST_TEST(!s.try_replace(7, 1, "x", 1));
+    BOOST_TEST(!s.try_replace(0, 1, "xy", 2));
+    BOOST_TEST(s == "abcdef");
+    BOOST_TEST(s.try_replace(0, 2, "xy", 2));
+    BOOST_TEST(s == "xycdef");
+    BOOST_TEST(s.try_replace(4, 10, "Z", 1));
+    BOOST_TEST(s == "xycdZ");
+    BOOST_TEST(s.try_replace(0, 1, s.data() + 3, 2));
+    BOOST_TEST(s == "dZycdZ");
+    BOOST_TEST(*s.end() == 0);
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    BOOST_TEST(s.try_replace(0, 6, string_view("ok")));
+    BOOST_TEST(s == "ok");
+#endif
+    s = "abcd";
+    static_string<8> f = "xyz";
+    BOOST_TEST(s.try_replace(1, 2, f));
+    BOOST_TEST(s == "axyzd");
+    BOOST_TEST(!s.try_replace(0, 0, f));
+    BOOST_TEST(!s.try_replace(6, 0, f));
+    BOOST_TEST(!s.try_replace(0, 1, f, 4));
+    BOOST_TEST(s.try_replace(0, 1, f, 2));
+    BOOST_TEST(s == "zxyzd");
+    BOOST_TEST(!s.try_replace(0, 3, s));
+    BOOST_TEST(s.try_replace(0, 4, s));
+    BOOST_TEST(s == "zxyzdd");
+    s = "abcd";
+    BOOST_TEST(s.try_replace(0, 1, s, 2, 2));
+    BOOST_TEST(s == "cdbcd");
+    BOOST_TEST(*s.end() == 0);
+  }
+
+  // the overflow policy is not involved
+  {
+    basic_static_string<2, char, std::char_traits<char>,
+      saturate_on_overflow> s = "ab";
+    BOOST_TEST(!s.try_append("c"));
+    BOOST_TEST(!s.overflow_policy().overflowed());
+  }
+}
+
+void
+testBuilder()
+{
+  {
+    static_string<16> s = "GET ";
+    {
+      static_string_builder<16> b(s);
+      BOOST_TEST(b.size() == 4);
+      BOOST_TEST(b.available() == 12);
+      b.append("/index");
+      b.push_back(' ');
+      b.append(static_string<3>("v1"));
+      b.append(2, '!');
+      BOOST_TEST(b.size() == 15);
+      // the string is not updated until committed
+      BOOST_TEST(s == "GET ");
+      BOOST_TEST(b.commit() == "GET /index v1!!");
+      b.append("x", 1);
+      BOOST_TEST(b.available() == 0);
+    }
+    BOOST_TEST(s == "GET /index v1!!x");
+    BOOST_TEST(*s.end() == 0);
+  }
+  {
+    static_string<8> s = "abc";
+    {
+      static_string_builder<8> b(s);
+      b.clear();
+      b.append("bc");
+      b.append(s.data(), 2);
+    }
+    BOOST_TEST(s == "bcbc");
+#ifdef BOOST_STATIC_STRING_HAS_ANY_STRING_VIEW
+    {
+      static_string_builder<8> b(s);
+      b.append(string_view("defg"));
+    }
+    BOOST_TEST(s == "bcbcdefg");
+#endif
+  }
+  {
+    static_string<0> s;
+    static_string_builder<0> b(s);
+    BOOST_TEST(b.available() == 0);
+    b.append("", 0);
+    BOOST_TEST(b.commit().empty());
+  }
+  // ranges and back_inserter
+  {
+    static_string<16> s = "<";
+    {
+      static_string_builder<16> b(s);
+      const std::string src = "hello";
+      b.append(src.begin(), src.end());
+      std::istringstream in("ab");
+      b.append(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+      auto out = std::transform(src.begin(), src.end(),
+        b.back_inserter(), [](char c) { return char(c - 32); });
+      *out++ = '>';
+      BOOST_TEST(b.size() == 14);
+      BOOST_TEST(s == "<");
+    }
+    BOOST_TEST(s == "<helloabHELLO>");
+    BOOST_TEST(*s.end() == 0);
+    {
+      static_string_builder<16> b(s);
+      b.clear();
+      std::fill_n(b.back_inserter(), 16, '=');
+      BOOST_TEST(b.available() == 0);
+    }
+    BOOST_TEST(s == "================");
+  }
+  // ranges and back_inserter check the capacity
+  {
+    static_string<4> s = "ab";
+    {
+      static_string_builder<4> b(s);
+      const std::string src = "cde";
+      BOOST_TEST_THROWS(b.append(src.begin(), src.end()),
+        std::length_error);
+      BOOST_TEST(b.size() == 2);
+      auto out = b.back_inserter();
+      *out++ = 'c';
+      *out++ = 'd';
+      BOOST_TEST_THROWS(*out++ = 'e', std::length_error);
+      BOOST_TEST(b.available() == 0);
+      std::istringstream in("x");
+      BOOST_TEST_THROWS(b.append(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>()), std::length_error);
+    }
+    BOOST_TEST(s == "abcd");
+
+    using sat_string = basic_static_string<
+      4, char, std::char_traits<char>, saturate_on_overflow>;
+    sat_string t = "ab";
+    {
+      basic_static_string_builder<4, char, std::char_traits<char>,
+        saturate_on_overflow> b(t);
+      const std::string src = "cde";
+      b.append(src.begin(), src.end());
+      BOOST_TEST(b.available() == 0);
+      std::fill_n(b.back_inserter(), 3, '!');
+      std::istringstream in("xyz");
+      b.append(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+    }
+    BOOST_TEST(t == "abcd");
+    BOOST_TEST(t.overflow_policy().overflowed());
+  }
+#ifdef BOOST_STATIC_STRING_HAS_WCHAR
+  {
+    static_wstring<8> s;
+    {
+      static_wstring_builder<8> b(s);
+      b.append(L"wide");
+    }
+    BOOST_TEST(s == L"wide");
+  }
+#endif
+}
+
 // issue 47
 struct issue_47 : static_string<32>
 {
@@ -7478,24 +9494,42 @@ runTests()
   testPushBack();
   testPopBack();
   testAppend();
+  testAppendNumber();
   testPlusEquals();
 
   testCompare();
+  testEquality();
   testSwap();
   testGeneral();
   testToStaticString();
+  testToNumber();
   testResize();
 
   testFind();
+  testFindLong();
+  testRFindLong();
+  testFindOfLong();
+  testSearcher();
 
   testReplace();
   testSubstr();
   testStartsEnds();
 
   testHash();
+  testFastHash();
+  testTransparent();
   testEmpty();
+  testUninitialized();
   testStream();
+  testStreamInput();
+  testOutputStream();
+  testFormat();
   testOperatorPlus();
+  testConcat();
+  testSplitJoin();
+  testOverflowPolicy();
+  testTryMutation();
+  testBuilder();
 
   return report_errors();
 }